@@ -27,6 +27,9 @@
 #include "views/GameView.h"
 #include "controllers/GameController.h"
 #include "views/LevelSelectScene.h"
+#include "configs/LevelConfigLoader.h"
+#include "views/CardViewPool.h"
+#include "views/CardFrameRegistry.h"
 
 // #define USE_AUDIO_ENGINE 1
 
@@ -109,8 +112,22 @@ bool AppDelegate::applicationDidFinishLaunching() {
 
     register_all_packages();
 
+    // shipped builds read levels from the compiled pack (tools/level_packer); without it, level_<id>.json is used
+    LevelConfigLoader::openPack("levels.pack");
+
+    // card textures are decoded asynchronously by LevelSelectScene's preloader (or on demand when resuming)
+    // pre-create one deck of card sprites; boards borrow them and give them back on restart
+    CardViewPool::prewarm(52);
+    // Director::reset() fires this after the running scene is gone and before the texture cache is destroyed
+    director->getEventDispatcher()->addCustomEventListener(Director::EVENT_RESET, [](EventCustom*) {
+        CardViewPool::purge();
+        CardFrameRegistry::unload();
+    });
+
     // create a scene. it's an autorelease object
-    auto scene = LevelSelectScene::createScene();
+    // resume an unfinished game if there is a save, otherwise show level select
+    auto scene = GameController::createResumedScene();
+    if (!scene) scene = LevelSelectScene::createScene();
 
     // run
     director->runWithScene(scene);
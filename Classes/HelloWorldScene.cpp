@@ -51,9 +51,9 @@ bool HelloWorld::init()
     CCLOG("=== Starting Model Test ===");
 
     auto gameModel = GameModel::create();
-    gameModel->retain(); // 
+    gameModel->retain(); // 保持引用
 
-    // ģⴴ
+    // 模拟创建两张牌
     auto card1 = CardModel::create(101, CardFace::Ace, CardSuit::Spades);
     card1->setFaceUp(true);
     gameModel->getAllCards().pushBack(card1);
@@ -61,11 +61,11 @@ bool HelloWorld::init()
     auto card2 = CardModel::create(102, CardFace::Ten, CardSuit::Hearts);
     gameModel->getAllCards().pushBack(card2);
 
-    // л 
+    // 测试序列化 
     std::string jsonStr = gameModel->serializeToJson();
     CCLOG("Serialized Data: %s", jsonStr.c_str());
 
-    // ֤
+    // 简单验证
     if (jsonStr.find("\"face\":1") != std::string::npos) {
         CCLOG("Test Passed: Ace of Spades found in JSON.");
     }
@@ -8,17 +8,57 @@
  * @brief 卡牌资源路径配置辅助类
  * * @func 提供根据卡牌花色、点数获取对应图片资源路径的静态方法。
  * @responsibility 负责资源路径的拼接逻辑，不持有任何状态。
- * @usage 在 View 层创建卡牌 Sprite 时调用。
+ * @usage 由 CardFrameRegistry 在启动时调用，解析出的句柄供 View 层复用。
  */
 class CardResConfig {
 public:
     /**
-     * @brief 获取卡牌正面图片的资源路径
+     * @brief 卡牌资源尺寸档位，对应 res/PNG 下的三套图片
+     */
+    enum class CardSize {
+        Small = 0,
+        Medium = 1,
+        Large = 2
+    };
+
+    /**
+     * @brief 卡牌图集的帧索引文件
+     * 由 card_atlas_packer 生成 (cmake --build . --target card_atlas)，全部牌面共享一张纹理，
+     * 整个桌面可以合并为一次绘制。
+     */
+    static std::string getAtlasPlistPath(CardSize size = CardSize::Large) {
+        return std::string("res/atlas/cards_") + getSizeName(size) + ".plist";
+    }
+
+    /**
+     * @brief 卡牌图集纹理 (与 plist 同名，供异步预加载)
+     */
+    static std::string getAtlasTexturePath(CardSize size = CardSize::Large) {
+        return std::string("res/atlas/cards_") + getSizeName(size) + ".png";
+    }
+
+    /**
+     * @brief 获取单张图片所在目录 (以 '/' 结尾)
+     */
+    static std::string getImageDirectory(CardSize size = CardSize::Large) {
+        return std::string("res/PNG/Cards (") + getSizeName(size) + ")/";
+    }
+
+    static const char* getSizeName(CardSize size) {
+        switch (size) {
+        case CardSize::Small:  return "small";
+        case CardSize::Medium: return "medium";
+        default:               return "large";
+        }
+    }
+
+    /**
+     * @brief 获取卡牌正面在图集中的帧名
      * @param suit 卡牌花色 (枚举)
      * @param face 卡牌点数 (枚举)
-     * @return std::string 完整的图片路径 (e.g., "res/PNG/Cards/card_spades_Q.png")
+     * @return std::string 帧名，与原图文件名一致 (e.g., "card_spades_Q.png")
      */
-    static std::string getCardImagePath(CardSuit suit, CardFace face) {
+    static std::string getCardFrameName(CardSuit suit, CardFace face) {
         // 1. 转换花色 (Enum -> String)
         std::string suitStr = "";
         switch (suit) {
@@ -38,16 +78,31 @@ public:
         else if (faceInt == 13) faceStr = "K";
         else faceStr = cocos2d::StringUtils::format("%02d", faceInt);
 
-        // 3. 拼接完整路径
-        return cocos2d::StringUtils::format("res/PNG/Cards (large)/card_%s_%s.png",
-            suitStr.c_str(), faceStr.c_str());
+        return cocos2d::StringUtils::format("card_%s_%s.png", suitStr.c_str(), faceStr.c_str());
+    }
+
+    /**
+     * @brief 获取卡牌背面在图集中的帧名
+     */
+    static std::string getBackFrameName() {
+        return "card_back.png";
+    }
+
+    /**
+     * @brief 获取卡牌正面图片的资源路径 (图集缺失时的回退)
+     * @param suit 卡牌花色 (枚举)
+     * @param face 卡牌点数 (枚举)
+     * @return std::string 完整的图片路径 (e.g., "res/PNG/Cards (large)/card_spades_Q.png")
+     */
+    static std::string getCardImagePath(CardSuit suit, CardFace face, CardSize size = CardSize::Large) {
+        return getImageDirectory(size) + getCardFrameName(suit, face);
     }
 
     /**
-     * @brief 获取卡牌背面图片的资源路径
+     * @brief 获取卡牌背面图片的资源路径 (图集缺失时的回退)
      * @return std::string 背面图片路径
      */
-    static std::string getBackImagePath() {
-        return "res/PNG/Cards (large)/card_back.png";
+    static std::string getBackImagePath(CardSize size = CardSize::Large) {
+        return getImageDirectory(size) + getBackFrameName();
     }
 };
\ No newline at end of file
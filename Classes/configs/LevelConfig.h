@@ -1,37 +1,52 @@
 #pragma once
 #include "cocos2d.h"
+#include "models/CoverGraph.h"
+#include <algorithm>
+#include <cstdint>
 #include <vector>
 
 /**
  * @struct CardConfigData
- * @brief ſƵĳʼ
- * л/лؿļеĿϢ
+ * @brief 单张卡牌的初始配置数据
+ * 用于序列化/反序列化关卡文件中的卡牌信息。
  */
 struct CardConfigData {
-    int cardFace;   ///<  1-13 (A-K)
-    int cardSuit;   ///< 滨ɫ 1-4
-    float x;        ///< ʼ X 
-    float y;        ///< ʼ Y 
-    int zOrder;     ///< ʼ㼶 (Z-Order)
-    bool isFaceUp;  ///< ʼ״̬Ƿ泯
+    int cardFace;   ///< 牌面点数 1-13 (A-K)
+    int cardSuit;   ///< 牌面花色 1-4
+    float x;        ///< 初始 X 坐标
+    float y;        ///< 初始 Y 坐标
+    int zOrder;     ///< 初始层级 (Z-Order)
+    bool isFaceUp;  ///< 初始状态是否正面朝上
+    uint8_t deck;   ///< 所属牌副 (多副牌模式，0 起；与花色、点数一起唯一确定一张牌)
 };
 
 /**
  * @class LevelConfig
- * @brief ؿ̬
- * * @func 洢 JSON ļصĹؿϢ
- * @responsibility ΪϷ߼
- * @usage  LevelConfigLoader أݸ GameController ʼƾ֡
+ * @brief 关卡静态配置数据类
+ * * @func 存储从 JSON 文件加载的关卡布局信息。
+ * @responsibility 仅作为数据容器，不包含游戏逻辑。
+ * @usage 由 LevelConfigLoader 加载，传递给 GameController 初始化牌局。
  */
 class LevelConfig {
 public:
-    int levelId;                                    ///< ؿ ID
-    std::vector<CardConfigData> playfieldCards;     ///< ϵĿб
-    std::vector<CardConfigData> drawStackCards;     ///< ƶѵĿб
+    int levelId;                                    ///< 关卡 ID
+    std::vector<CardConfigData> playfieldCards;     ///< 主牌桌上的卡牌配置列表
+    std::vector<CardConfigData> drawStackCards;     ///< 备用牌堆的卡牌配置列表
+    CoverGraph coverGraph;                          ///< 桌面牌静态遮挡关系 (节点为 playfieldCards 下标)
 
     /**
-     * @brief ǷϷ
-     * @return bool Ϊ򷵻 true
+     * @brief 配置中用到的牌副数 (最大牌副序号 + 1)
+     */
+    int getDeckCount() const {
+        int deckCount = 1;
+        for (const auto& card : playfieldCards) deckCount = std::max(deckCount, card.deck + 1);
+        for (const auto& card : drawStackCards) deckCount = std::max(deckCount, card.deck + 1);
+        return deckCount;
+    }
+
+    /**
+     * @brief 检查配置数据是否合法
+     * @return bool 如果主牌桌不为空则返回 true
      */
     bool isValid() const { return !playfieldCards.empty(); }
 };
\ No newline at end of file
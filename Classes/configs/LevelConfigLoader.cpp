@@ -1,48 +1,161 @@
 #include "LevelConfigLoader.h"
-#include "json/stringbuffer.h"
+#include "json/reader.h"
+#include "json/error/en.h"
+#include "services/GameRuleService.h"
+#include <algorithm>
+#include <cstring>
 
 USING_NS_CC;
 
+LevelPack LevelConfigLoader::_pack;
+
+namespace {
+    /**
+     * @brief 关卡 JSON 的 SAX 处理器
+     * 按事件直接写入 LevelConfig：根对象的 levelId / playfield / drawStack，
+     * 以及两个数组中卡牌对象的 face / suit / x / y / z / faceUp / deck。其余内容按层级跳过。
+     */
+    class LevelSaxHandler : public rapidjson::BaseReaderHandler<rapidjson::UTF8<>, LevelSaxHandler> {
+    public:
+        explicit LevelSaxHandler(LevelConfig& config) : _config(config) {}
+
+        bool StartObject() {
+            _depth++;
+            // 根对象 (1) -> 卡牌数组 (2) -> 卡牌对象 (3)
+            if (_depth == 3 && _pile) {
+                CardConfigData card;
+                card.cardFace = 1;
+                card.cardSuit = 1;
+                card.x = 0.0f;
+                card.y = 0.0f;
+                card.zOrder = 0;
+                card.isFaceUp = false;
+                card.deck = 0;
+                _pile->push_back(card);
+                _card = &_pile->back();
+            }
+            _field = None;
+            return true;
+        }
+
+        bool EndObject(rapidjson::SizeType) {
+            if (_depth == 3) _card = nullptr;
+            _depth--;
+            return true;
+        }
+
+        bool StartArray() {
+            _depth++;
+            if (_depth == 2) {
+                if (_field == Playfield) _pile = &_config.playfieldCards;
+                else if (_field == DrawStack) _pile = &_config.drawStackCards;
+            }
+            _field = None;
+            return true;
+        }
+
+        bool EndArray(rapidjson::SizeType) {
+            if (_depth == 2) _pile = nullptr;
+            _depth--;
+            return true;
+        }
+
+        bool Key(const char* str, rapidjson::SizeType length, bool) {
+            _field = None;
+            if (_depth == 1) {
+                if (_equals(str, length, "levelId")) _field = LevelId;
+                else if (_equals(str, length, "playfield")) _field = Playfield;
+                else if (_equals(str, length, "drawStack")) _field = DrawStack;
+            }
+            else if (_depth == 3 && _card) {
+                if (_equals(str, length, "face")) _field = Face;
+                else if (_equals(str, length, "suit")) _field = Suit;
+                else if (_equals(str, length, "x")) _field = X;
+                else if (_equals(str, length, "y")) _field = Y;
+                else if (_equals(str, length, "z")) _field = Z;
+                else if (_equals(str, length, "faceUp")) _field = FaceUp;
+                else if (_equals(str, length, "deck")) _field = Deck;
+            }
+            return true;
+        }
+
+        bool Int(int value) { return _integer(value); }
+        bool Uint(unsigned value) { return _integer((int64_t)value); }
+        bool Int64(int64_t value) { return _integer(value); }
+        bool Uint64(uint64_t value) { return _integer((int64_t)value); }
+
+        bool Double(double value) {
+            if (_field == X) _card->x = (float)value;
+            else if (_field == Y) _card->y = (float)value;
+            else return _integer((int64_t)value);
+            _field = None;
+            return true;
+        }
+
+        bool Bool(bool value) {
+            if (_field == FaceUp) _card->isFaceUp = value;
+            _field = None;
+            return true;
+        }
+
+        // 字符串、null 等其余值一律忽略
+        bool Default() {
+            _field = None;
+            return true;
+        }
+
+    private:
+        enum Field { None, LevelId, Playfield, DrawStack, Face, Suit, X, Y, Z, FaceUp, Deck };
+
+        static bool _equals(const char* str, rapidjson::SizeType length, const char* key) {
+            return strlen(key) == length && memcmp(str, key, length) == 0;
+        }
+
+        bool _integer(int64_t value) {
+            switch (_field) {
+            case LevelId: _config.levelId = (int)value; break;
+            case Face: _card->cardFace = (int)value; break;
+            case Suit: _card->cardSuit = (int)value; break;
+            case X: _card->x = (float)value; break;
+            case Y: _card->y = (float)value; break;
+            case Z: _card->zOrder = (int)value; break;
+            case FaceUp: _card->isFaceUp = value != 0; break;
+            case Deck: _card->deck = (uint8_t)std::max<int64_t>(0, std::min<int64_t>(value, 255)); break;
+            default: break;
+            }
+            _field = None;
+            return true;
+        }
+
+        LevelConfig& _config;
+        int _depth = 0;
+        Field _field = None;
+        std::vector<CardConfigData>* _pile = nullptr;   ///< 正在填充的卡牌数组
+        CardConfigData* _card = nullptr;                 ///< 正在填充的卡牌 (_pile 末尾)
+    };
+}
+
 LevelConfig LevelConfigLoader::loadLevel(const std::string& filename) {
     LevelConfig config;
     config.levelId = 0;
 
-    // 1. ȡļ
+    // 1. 读取文件内容 (std::string 自带结尾 '\0'，可直接作为原地解析的缓冲)
     std::string jsonContent = FileUtils::getInstance()->getStringFromFile(filename);
     if (jsonContent.empty()) {
         CCLOG("Error: Level file not found: %s", filename.c_str());
         return config;
     }
 
-    // 2.  JSON
-    rapidjson::Document doc;
-    doc.Parse(jsonContent.c_str());
-
-    if (doc.HasParseError()) {
+    // 2. 解析 JSON
+    if (!parseLevel(&jsonContent[0], jsonContent.size(), config)) {
         CCLOG("Error: JSON parse error in %s", filename.c_str());
+        config.playfieldCards.clear();
+        config.drawStackCards.clear();
         return config;
     }
 
-    // 3. Ϣ
-    if (doc.HasMember("levelId")) {
-        config.levelId = doc["levelId"].GetInt();
-    }
-
-    // 4. 
-    if (doc.HasMember("playfield") && doc["playfield"].IsArray()) {
-        const rapidjson::Value& arr = doc["playfield"];
-        for (rapidjson::SizeType i = 0; i < arr.Size(); ++i) {
-            config.playfieldCards.push_back(_parseCardData(arr[i]));
-        }
-    }
-
-    // 5. ƶ
-    if (doc.HasMember("drawStack") && doc["drawStack"].IsArray()) {
-        const rapidjson::Value& arr = doc["drawStack"];
-        for (rapidjson::SizeType i = 0; i < arr.Size(); ++i) {
-            config.drawStackCards.push_back(_parseCardData(arr[i]));
-        }
-    }
+    // 3. 位置在加载后不再变化，一次性构建遮挡关系
+    config.coverGraph = GameRuleService::buildCoverGraph(config.playfieldCards);
 
     CCLOG("Level Loaded: Playfield count: %d, DrawStack count: %d",
         (int)config.playfieldCards.size(),
@@ -51,14 +164,30 @@ LevelConfig LevelConfigLoader::loadLevel(const std::string& filename) {
     return config;
 }
 
-CardConfigData LevelConfigLoader::_parseCardData(const rapidjson::Value& item) {
-    CardConfigData card;
-    // ϽͼĬֵ֤ȫ
-    card.cardFace = item.HasMember("face") ? item["face"].GetInt() : 1;
-    card.cardSuit = item.HasMember("suit") ? item["suit"].GetInt() : 1;
-    card.x = item.HasMember("x") ? item["x"].GetFloat() : 0.0f;
-    card.y = item.HasMember("y") ? item["y"].GetFloat() : 0.0f;
-    card.zOrder = item.HasMember("z") ? item["z"].GetInt() : 0;
-    card.isFaceUp = item.HasMember("faceUp") ? item["faceUp"].GetBool() : false;
-    return card;
-}
\ No newline at end of file
+bool LevelConfigLoader::parseLevel(char* json, size_t size, LevelConfig& config) {
+    // 每张卡牌对应一个 '{'，据此预留容量，避免大关卡反复扩容 (两个数组各预留上限，多占的内存很少)
+    size_t objects = (size_t)std::count(json, json + size, '{');
+    config.playfieldCards.reserve(objects);
+    config.drawStackCards.reserve(objects);
+
+    LevelSaxHandler handler(config);
+    rapidjson::Reader reader;
+    rapidjson::InsituStringStream stream(json);
+    rapidjson::ParseResult result = reader.Parse<rapidjson::kParseInsituFlag>(stream, handler);
+    if (result.IsError()) {
+        CCLOG("JSON error at offset %d: %s", (int)result.Offset(), rapidjson::GetParseError_En(result.Code()));
+        return false;
+    }
+    return true;
+}
+
+bool LevelConfigLoader::openPack(const std::string& filename) {
+    return _pack.open(filename);
+}
+
+LevelConfig LevelConfigLoader::loadLevelById(int levelId) {
+    LevelPack::LevelView view = _pack.getLevel(levelId);
+    if (view.isValid()) return view.toLevelConfig();
+
+    return loadLevel(StringUtils::format("level_%d.json", levelId));
+}
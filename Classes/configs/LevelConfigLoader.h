@@ -1,29 +1,52 @@
 #pragma once
 #include "LevelConfig.h"
-#include "json/document.h" // Ҫ rapidjson ͷļ֧˽зĲ
+#include "LevelPack.h"
 #include <string>
 
 /**
  * @class LevelConfigLoader
- * @brief ؿü
- * * @func ȡ JSON ļΪ LevelConfig 
- * @responsibility ļ I/O  JSON ߼
- * @usage ̬ loadLevel 
+ * @brief 关卡配置加载器
+ * * @func 读取 JSON 配置文件并解析为 LevelConfig 对象。
+ * @responsibility 处理文件 I/O 和 JSON 解析逻辑。以 SAX 方式原地解析文件缓冲，不构建 DOM，直接写入卡牌数组。
+ * @usage 静态调用 loadLevel 方法；发布版本启动时 openPack 打开编译好的关卡包后，用 loadLevelById 按 ID 读取。
  */
 class LevelConfigLoader {
 public:
     /**
-     * @brief ȡ JSON ļö
-     * @param filename ļ· ( Resources Ŀ¼)
-     * @return LevelConfig ö
+     * @brief 读取 JSON 文件并返回配置对象
+     * @param filename 配置文件路径 (相对于 Resources 目录)
+     * @return LevelConfig 解析后的配置对象
      */
     static LevelConfig loadLevel(const std::string& filename);
 
-private:
     /**
-     * @brief ݵ˽и
-     * @param item rapidjson  Value 
-     * @return CardConfigData Ŀݽṹ
+     * @brief 原地解析关卡 JSON (只填充 levelId 与卡牌列表，不构建遮挡关系)
+     * 缺失的字段取默认值，未知字段与嵌套内容被忽略。
+     * @param json 以 '\0' 结尾的可写缓冲，解析过程中会被改写 (字符串原地反转义)
+     * @param size 缓冲长度 (不含结尾 '\0')，用于预估卡牌数量
+     * @param config 输出配置
+     * @return bool 是否为合法 JSON
+     */
+    static bool parseLevel(char* json, size_t size, LevelConfig& config);
+
+    /**
+     * @brief 打开二进制关卡包 (主线程调用，之后可在任意线程按 ID 读取)
+     * @param filename 关卡包路径 (相对于 Resources 目录)
+     * @return bool 打开是否成功；失败时 loadLevelById 全部回退到 JSON
+     */
+    static bool openPack(const std::string& filename);
+
+    static const LevelPack& getPack() { return _pack; }
+
+    /**
+     * @brief 按关卡 ID 读取配置
+     * 关卡包中存在时直接拷贝包内记录，否则读取 level_<id>.json。
+     * JSON 回退会经过 FileUtils 路径解析，只能在主线程调用；工作线程应先用 getPack().hasLevel 判断。
+     * @param levelId 关卡 ID
+     * @return LevelConfig 解析后的配置对象
      */
-    static CardConfigData _parseCardData(const rapidjson::Value& item);
+    static LevelConfig loadLevelById(int levelId);
+
+private:
+    static LevelPack _pack;     ///< 发布用关卡包 (未打开时为空)
 };
\ No newline at end of file
@@ -0,0 +1,83 @@
+#include "LevelConfigWriter.h"
+#include "json/stringbuffer.h"
+#include "json/writer.h"
+#include "json/prettywriter.h"
+#include <cmath>
+
+USING_NS_CC;
+
+namespace {
+    // 坐标为整数时按整数写出，保持与手写关卡一致
+    template <typename Writer>
+    void writeNumber(Writer& writer, float value) {
+        if (std::floor(value) == value) writer.Int((int)value);
+        else writer.Double(value);
+    }
+
+    template <typename Writer>
+    void writeCard(Writer& writer, const CardConfigData& card, bool withLayout) {
+        writer.StartObject();
+        writer.Key("face");
+        writer.Int(card.cardFace);
+        writer.Key("suit");
+        writer.Int(card.cardSuit);
+        // 单副牌关卡不写 deck，保持与手写关卡一致
+        if (card.deck != 0) {
+            writer.Key("deck");
+            writer.Int(card.deck);
+        }
+        if (withLayout) {
+            writer.Key("x");
+            writeNumber(writer, card.x);
+            writer.Key("y");
+            writeNumber(writer, card.y);
+            writer.Key("z");
+            writer.Int(card.zOrder);
+            writer.Key("faceUp");
+            writer.Bool(card.isFaceUp);
+        }
+        writer.EndObject();
+    }
+
+    template <typename Writer>
+    void writeLevel(Writer& writer, const LevelConfig& config) {
+        writer.StartObject();
+        writer.Key("levelId");
+        writer.Int(config.levelId);
+
+        writer.Key("playfield");
+        writer.StartArray();
+        for (const auto& card : config.playfieldCards) writeCard(writer, card, true);
+        writer.EndArray();
+
+        // 备用牌堆只有点数与花色，位置由 View 决定
+        writer.Key("drawStack");
+        writer.StartArray();
+        for (const auto& card : config.drawStackCards) writeCard(writer, card, false);
+        writer.EndArray();
+
+        writer.EndObject();
+    }
+}
+
+std::string LevelConfigWriter::toJson(const LevelConfig& config, bool pretty) {
+    rapidjson::StringBuffer buffer;
+    if (pretty) {
+        rapidjson::PrettyWriter<rapidjson::StringBuffer> writer(buffer);
+        writer.SetIndent(' ', 2);
+        writeLevel(writer, config);
+    }
+    else {
+        rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+        writeLevel(writer, config);
+    }
+    return std::string(buffer.GetString(), buffer.GetSize());
+}
+
+bool LevelConfigWriter::saveLevel(const LevelConfig& config, const std::string& filename) {
+    if (!FileUtils::getInstance()->writeStringToFile(toJson(config), filename)) {
+        CCLOG("Error: Failed to write level file: %s", filename.c_str());
+        return false;
+    }
+    return true;
+}
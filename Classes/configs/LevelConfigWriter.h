@@ -0,0 +1,29 @@
+#pragma once
+#include "LevelConfig.h"
+#include <string>
+
+/**
+ * @class LevelConfigWriter
+ * @brief 关卡配置写出器
+ * * @func 将 LevelConfig 序列化为与 LevelConfigLoader 相同格式的 JSON。
+ * @responsibility 只负责格式转换与文件写入，与 LevelConfigLoader 互为逆操作。
+ * @usage 关卡生成工具、调试导出时静态调用。
+ */
+class LevelConfigWriter {
+public:
+    /**
+     * @brief 序列化为 JSON 字符串
+     * @param config 关卡配置
+     * @param pretty 是否缩进排版 (与手写关卡文件风格一致)
+     * @return std::string JSON 文本
+     */
+    static std::string toJson(const LevelConfig& config, bool pretty = true);
+
+    /**
+     * @brief 写入 JSON 文件
+     * @param config 关卡配置
+     * @param filename 目标文件的完整路径
+     * @return bool 写入是否成功
+     */
+    static bool saveLevel(const LevelConfig& config, const std::string& filename);
+};
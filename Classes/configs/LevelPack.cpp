@@ -0,0 +1,245 @@
+#include "LevelPack.h"
+#include "services/GameRuleService.h"
+#include "utils/BinaryStream.h"
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+USING_NS_CC;
+
+// 卡牌记录直接以 CardConfigData 访问，布局变化时必须同步修改 LevelPackWriter 与版本号
+static_assert(std::is_standard_layout<CardConfigData>::value, "CardConfigData must be standard layout");
+static_assert(sizeof(CardConfigData) == LevelPack::kCardRecordSize, "CardConfigData size changed");
+static_assert(offsetof(CardConfigData, cardFace) == 0 && offsetof(CardConfigData, cardSuit) == 4
+    && offsetof(CardConfigData, x) == 8 && offsetof(CardConfigData, y) == 12
+    && offsetof(CardConfigData, zOrder) == 16 && offsetof(CardConfigData, isFaceUp) == 20
+    && offsetof(CardConfigData, deck) == 21,
+    "CardConfigData field offsets changed");
+static_assert(sizeof(bool) == 1, "LevelPack records store bool as one byte");
+
+namespace {
+    const uint8_t kMagic[4] = { 'S', 'L', 'V', 'P' };
+
+    bool isLittleEndian() {
+        const uint16_t probe = 1;
+        uint8_t firstByte;
+        memcpy(&firstByte, &probe, 1);
+        return firstByte == 1;
+    }
+
+    uint32_t readU32At(const uint8_t* p) {
+        return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+    }
+
+    uint16_t readU16At(const uint8_t* p) {
+        return (uint16_t)(p[0] | (p[1] << 8));
+    }
+
+    // 记录会被直接当作 CardConfigData 使用：点数、花色须在范围内，bool 字节只能是 0 或 1
+    bool isValidRecord(const uint8_t* record) {
+        int32_t face = (int32_t)readU32At(record + offsetof(CardConfigData, cardFace));
+        int32_t suit = (int32_t)readU32At(record + offsetof(CardConfigData, cardSuit));
+        uint8_t faceUp = record[offsetof(CardConfigData, isFaceUp)];
+        return face >= 1 && face <= 13 && suit >= 0 && suit <= 3 && faceUp <= 1;
+    }
+}
+
+LevelConfig LevelPack::LevelView::toLevelConfig() const {
+    LevelConfig config;
+    config.levelId = levelId;
+    if (!isValid()) return config;
+
+    config.playfieldCards.assign(playfield, playfield + playfieldCount);
+    config.drawStackCards.assign(drawStack, drawStack + drawStackCount);
+    config.coverGraph = GameRuleService::buildCoverGraph(config.playfieldCards);
+    return config;
+}
+
+LevelPack::~LevelPack() {
+    close();
+}
+
+bool LevelPack::open(const std::string& filename) {
+    close();
+
+    if (!isLittleEndian()) {
+        CCLOG("Error: LevelPack requires a little-endian host");
+        return false;
+    }
+
+    std::string fullPath = FileUtils::getInstance()->fullPathForFilename(filename);
+    if (fullPath.empty()) {
+        CCLOG("LevelPack: file not found: %s", filename.c_str());
+        return false;
+    }
+
+    // 1. 优先内存映射：只有被访问的关卡页会读入，打开耗时与关卡数量无关
+#ifdef _WIN32
+    int length = MultiByteToWideChar(CP_UTF8, 0, fullPath.c_str(), -1, nullptr, 0);
+    std::wstring widePath(length > 0 ? length - 1 : 0, L'\0');
+    if (length > 0) MultiByteToWideChar(CP_UTF8, 0, fullPath.c_str(), -1, &widePath[0], length);
+
+    HANDLE file = CreateFileW(widePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+        FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file != INVALID_HANDLE_VALUE) {
+        LARGE_INTEGER fileSize;
+        if (GetFileSizeEx(file, &fileSize) && fileSize.QuadPart > 0) {
+            HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (mapping) {
+                void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+                if (view) {
+                    _data = (const uint8_t*)view;
+                    _size = (size_t)fileSize.QuadPart;
+                    _mapped = true;
+                    _mapHandle = mapping;
+                }
+                else {
+                    CloseHandle(mapping);
+                }
+            }
+        }
+        CloseHandle(file);
+    }
+#else
+    int fd = ::open(fullPath.c_str(), O_RDONLY);
+    if (fd >= 0) {
+        struct stat st;
+        if (fstat(fd, &st) == 0 && st.st_size > 0) {
+            void* view = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (view != MAP_FAILED) {
+                _data = (const uint8_t*)view;
+                _size = (size_t)st.st_size;
+                _mapped = true;
+            }
+        }
+        ::close(fd);
+    }
+#endif
+
+    // 2. 无法映射 (如 Android 的 APK 内资源) 时整体读入
+    if (!_data) {
+        Data data = FileUtils::getInstance()->getDataFromFile(fullPath);
+        if (data.isNull()) {
+            CCLOG("Error: Failed to read level pack: %s", fullPath.c_str());
+            return false;
+        }
+        _buffer.assign(data.getBytes(), data.getBytes() + data.getSize());
+        _data = _buffer.data();
+        _size = _buffer.size();
+    }
+
+    if (!_validate()) {
+        CCLOG("Error: Invalid level pack: %s", fullPath.c_str());
+        close();
+        return false;
+    }
+
+    CCLOG("LevelPack: %d levels from %s (%s)", (int)_levelCount, fullPath.c_str(), _mapped ? "mapped" : "buffered");
+    return true;
+}
+
+void LevelPack::close() {
+    if (_mapped) {
+#ifdef _WIN32
+        UnmapViewOfFile(_data);
+        CloseHandle((HANDLE)_mapHandle);
+#else
+        munmap((void*)_data, _size);
+#endif
+    }
+
+    _data = nullptr;
+    _size = 0;
+    _mapped = false;
+    _mapHandle = nullptr;
+    _buffer.clear();
+    _buffer.shrink_to_fit();
+    _levelCount = 0;
+    _firstLevelId = 0;
+    _indexCount = 0;
+}
+
+bool LevelPack::_validate() {
+    if (_size < (size_t)kHeaderSize) return false;
+
+    ByteReader reader(_data, kHeaderSize);
+    uint8_t magic[4];
+    for (int i = 0; i < 4; ++i) magic[i] = reader.readU8();
+    uint16_t version = reader.readU16();
+    uint16_t recordSize = reader.readU16();
+    _levelCount = reader.readU32();
+    _firstLevelId = (int32_t)reader.readU32();
+    _indexCount = reader.readU32();
+    uint32_t fileSize = reader.readU32();
+
+    if (!reader.isOk() || memcmp(magic, kMagic, sizeof(kMagic)) != 0) return false;
+    if (version != kVersion || recordSize != kCardRecordSize) {
+        CCLOG("Error: Level pack version %d (record %d) unsupported", (int)version, (int)recordSize);
+        return false;
+    }
+    if (fileSize != _size) return false;
+    if ((uint64_t)kHeaderSize + (uint64_t)_indexCount * kIndexEntrySize > _size) return false;
+
+    // 索引与卡牌记录只在打开时校验一次，之后 getLevel 不再做边界检查
+    uint32_t present = 0;
+    const uint8_t* entry = _data + kHeaderSize;
+    for (uint32_t i = 0; i < _indexCount; ++i, entry += kIndexEntrySize) {
+        uint32_t offset = readU32At(entry);
+        if (offset == 0) continue;
+
+        uint64_t cards = (uint64_t)readU16At(entry + 4) + readU16At(entry + 6);
+        if (offset % 4 != 0 || (uint64_t)offset + cards * kCardRecordSize > _size) return false;
+        for (uint64_t c = 0; c < cards; ++c) {
+            if (!isValidRecord(_data + offset + c * kCardRecordSize)) {
+                CCLOG("Error: Level pack record %d of level %d is out of range", (int)c, _firstLevelId + (int)i);
+                return false;
+            }
+        }
+        present++;
+    }
+    return present == _levelCount;
+}
+
+const uint8_t* LevelPack::_findEntry(int levelId) const {
+    if (!_data) return nullptr;
+
+    int64_t slot = (int64_t)levelId - _firstLevelId;
+    if (slot < 0 || slot >= (int64_t)_indexCount) return nullptr;
+
+    const uint8_t* entry = _data + kHeaderSize + slot * kIndexEntrySize;
+    return readU32At(entry) != 0 ? entry : nullptr;
+}
+
+LevelPack::LevelView LevelPack::getLevel(int levelId) const {
+    LevelView view;
+    view.levelId = levelId;
+
+    const uint8_t* entry = _findEntry(levelId);
+    if (!entry) return view;
+
+    const CardConfigData* records = (const CardConfigData*)(_data + readU32At(entry));
+    view.playfieldCount = readU16At(entry + 4);
+    view.drawStackCount = readU16At(entry + 6);
+    view.playfield = records;
+    view.drawStack = records + view.playfieldCount;
+    return view;
+}
+
+std::vector<int> LevelPack::getLevelIds() const {
+    std::vector<int> ids;
+    ids.reserve(_levelCount);
+    for (uint32_t i = 0; i < _indexCount; ++i) {
+        int levelId = _firstLevelId + (int)i;
+        if (_findEntry(levelId)) ids.push_back(levelId);
+    }
+    return ids;
+}
@@ -0,0 +1,97 @@
+#pragma once
+#include "LevelConfig.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @class LevelPack
+ * @brief 二进制关卡包 (只读)
+ * @responsibility 将 level_packer 编译出的关卡包映射到内存 (不支持映射的平台整体读入)，
+ *                 按关卡 ID 以 O(1) 查索引，直接返回指向文件内卡牌记录的视图，不做解析与拷贝。
+ * @usage 启动时由 LevelConfigLoader::openPack 在主线程打开；打开后只读，可在工作线程并发查询。
+ *
+ * 文件布局 (小端序，所有偏移 4 字节对齐):
+ *   Header       24 字节: magic "SLVP", u16 版本, u16 卡牌记录大小, u32 关卡数, i32 首个关卡 ID, u32 索引项数, u32 文件大小
+ *   Index        索引项数 x 8 字节: u32 记录偏移 (0 表示该 ID 无关卡), u16 桌面牌数, u16 备用牌数
+ *                第 i 项对应关卡 ID = 首个关卡 ID + i
+ *   Records      每关先桌面牌后备用牌，每张为与 CardConfigData 内存布局一致的 24 字节记录
+ *                (偏移 21 的字节为牌副序号，单副牌关卡恒为 0)
+ */
+class LevelPack {
+public:
+    static const uint16_t kVersion = 1;
+    static const int kHeaderSize = 24;
+    static const int kIndexEntrySize = 8;
+    static const int kCardRecordSize = 24;
+
+    /**
+     * @struct LevelView
+     * @brief 包内单个关卡的零拷贝视图
+     * 指针指向映射内存，在 LevelPack 关闭前有效。
+     */
+    struct LevelView {
+        int levelId = 0;
+        const CardConfigData* playfield = nullptr;
+        int playfieldCount = 0;
+        const CardConfigData* drawStack = nullptr;
+        int drawStackCount = 0;
+
+        bool isValid() const { return playfieldCount > 0; }
+
+        /**
+         * @brief 拷贝为可修改的 LevelConfig 并构建遮挡关系
+         */
+        LevelConfig toLevelConfig() const;
+    };
+
+    LevelPack() = default;
+    ~LevelPack();
+
+    LevelPack(const LevelPack&) = delete;
+    LevelPack& operator=(const LevelPack&) = delete;
+
+    /**
+     * @brief 打开关卡包 (已打开时先关闭)
+     * @param filename 文件路径 (可为相对 Resources 的路径)
+     * @return bool 文件存在且头部、索引与卡牌记录校验通过
+     */
+    bool open(const std::string& filename);
+
+    void close();
+
+    bool isOpen() const { return _data != nullptr; }
+
+    int getLevelCount() const { return (int)_levelCount; }
+
+    bool hasLevel(int levelId) const { return _findEntry(levelId) != nullptr; }
+
+    /**
+     * @brief 按 ID 取关卡视图
+     * @return LevelView 不存在时 isValid() 为 false
+     */
+    LevelView getLevel(int levelId) const;
+
+    /**
+     * @brief 包内全部关卡 ID (升序)
+     */
+    std::vector<int> getLevelIds() const;
+
+private:
+    // 校验头部与索引，失败时返回 false (不关闭)
+    bool _validate();
+
+    // 关卡对应的索引项，不存在时返回 nullptr
+    const uint8_t* _findEntry(int levelId) const;
+
+    const uint8_t* _data = nullptr;     ///< 文件内容起始地址 (映射或 _buffer)
+    size_t _size = 0;
+
+    bool _mapped = false;               ///< _data 是否来自内存映射
+    void* _mapHandle = nullptr;         ///< Windows 映射对象句柄
+    std::vector<uint8_t> _buffer;       ///< 无法映射时的整体读入缓冲
+
+    uint32_t _levelCount = 0;
+    int32_t _firstLevelId = 0;
+    uint32_t _indexCount = 0;
+};
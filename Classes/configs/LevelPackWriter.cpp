@@ -0,0 +1,132 @@
+#include "LevelPackWriter.h"
+#include "LevelPack.h"
+#include "utils/BinaryStream.h"
+#include <algorithm>
+#include <cstring>
+
+USING_NS_CC;
+
+namespace {
+    const uint8_t kMagic[4] = { 'S', 'L', 'V', 'P' };
+    const size_t kMaxCardsPerPile = 0xFFFF;
+    const uint32_t kMaxIndexSpan = 1u << 20;    ///< 关卡 ID 跨度上限 (索引 8MB)
+
+    uint32_t floatBits(float value) {
+        uint32_t bits;
+        memcpy(&bits, &value, sizeof(bits));
+        return bits;
+    }
+
+    // 与 CardConfigData 的内存布局逐字节一致 (填充字节写 0)
+    void writeCard(ByteWriter& writer, const CardConfigData& card) {
+        writer.writeU32((uint32_t)card.cardFace);
+        writer.writeU32((uint32_t)card.cardSuit);
+        writer.writeU32(floatBits(card.x));
+        writer.writeU32(floatBits(card.y));
+        writer.writeU32((uint32_t)card.zOrder);
+        writer.writeU8(card.isFaceUp ? 1 : 0);
+        writer.writeU8(card.deck);
+        writer.writeU16(0);
+    }
+}
+
+bool LevelPackWriter::build(const std::vector<LevelConfig>& levels, std::vector<uint8_t>& out) {
+    out.clear();
+    if (levels.empty()) {
+        CCLOG("Error: Level pack has no levels");
+        return false;
+    }
+
+    // 1. 按 ID 排序并检查
+    std::vector<const LevelConfig*> sorted;
+    sorted.reserve(levels.size());
+    for (const auto& level : levels) sorted.push_back(&level);
+    std::sort(sorted.begin(), sorted.end(), [](const LevelConfig* a, const LevelConfig* b) {
+        return a->levelId < b->levelId;
+    });
+
+    for (size_t i = 0; i < sorted.size(); ++i) {
+        const LevelConfig* level = sorted[i];
+        if (!level->isValid()) {
+            CCLOG("Error: Level %d has no playfield cards", level->levelId);
+            return false;
+        }
+        if (level->playfieldCards.size() > kMaxCardsPerPile || level->drawStackCards.size() > kMaxCardsPerPile) {
+            CCLOG("Error: Level %d has too many cards", level->levelId);
+            return false;
+        }
+        if (i > 0 && sorted[i - 1]->levelId == level->levelId) {
+            CCLOG("Error: Duplicate level id %d", level->levelId);
+            return false;
+        }
+    }
+
+    int32_t firstId = sorted.front()->levelId;
+    uint32_t indexCount = (uint32_t)((int64_t)sorted.back()->levelId - firstId + 1);
+    if (indexCount > kMaxIndexSpan) {
+        CCLOG("Error: Level id range too sparse (%u slots)", indexCount);
+        return false;
+    }
+
+    // 2. 计算各关卡记录偏移 (头部与索引都是 4 的倍数，记录天然对齐)
+    size_t recordStart = LevelPack::kHeaderSize + (size_t)indexCount * LevelPack::kIndexEntrySize;
+    size_t totalSize = recordStart;
+    for (const LevelConfig* level : sorted) {
+        totalSize += (level->playfieldCards.size() + level->drawStackCards.size()) * LevelPack::kCardRecordSize;
+    }
+    if (totalSize > 0xFFFFFFFFu) {
+        CCLOG("Error: Level pack exceeds 4GB");
+        return false;
+    }
+
+    out.reserve(totalSize);
+    ByteWriter writer(out);
+
+    // 3. 头部
+    writer.writeBytes(kMagic, sizeof(kMagic));
+    writer.writeU16(LevelPack::kVersion);
+    writer.writeU16((uint16_t)LevelPack::kCardRecordSize);
+    writer.writeU32((uint32_t)sorted.size());
+    writer.writeU32((uint32_t)firstId);
+    writer.writeU32(indexCount);
+    writer.writeU32((uint32_t)totalSize);
+
+    // 4. 索引 (ID 空缺处偏移为 0)
+    size_t next = 0;
+    size_t offset = recordStart;
+    for (uint32_t slot = 0; slot < indexCount; ++slot) {
+        const LevelConfig* level = sorted[next];
+        if (level->levelId != firstId + (int32_t)slot) {
+            writer.writeU32(0);
+            writer.writeU32(0);
+            continue;
+        }
+
+        writer.writeU32((uint32_t)offset);
+        writer.writeU16((uint16_t)level->playfieldCards.size());
+        writer.writeU16((uint16_t)level->drawStackCards.size());
+        offset += (level->playfieldCards.size() + level->drawStackCards.size()) * LevelPack::kCardRecordSize;
+        next++;
+    }
+
+    // 5. 卡牌记录
+    for (const LevelConfig* level : sorted) {
+        for (const auto& card : level->playfieldCards) writeCard(writer, card);
+        for (const auto& card : level->drawStackCards) writeCard(writer, card);
+    }
+
+    return writer.size() == totalSize;
+}
+
+bool LevelPackWriter::savePack(const std::vector<LevelConfig>& levels, const std::string& filename) {
+    std::vector<uint8_t> bytes;
+    if (!build(levels, bytes)) return false;
+
+    Data data;
+    data.copy(bytes.data(), (ssize_t)bytes.size());
+    if (!FileUtils::getInstance()->writeDataToFile(data, filename)) {
+        CCLOG("Error: Failed to write level pack: %s", filename.c_str());
+        return false;
+    }
+    return true;
+}
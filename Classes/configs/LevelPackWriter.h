@@ -0,0 +1,31 @@
+#pragma once
+#include "LevelConfig.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @class LevelPackWriter
+ * @brief 二进制关卡包写出器
+ * * @func 将多个 LevelConfig 编译为 LevelPack 格式 (布局见 LevelPack.h)。
+ * @responsibility 只负责格式编码与文件写入，按字段写出小端序数据，与编译机的字节序无关。
+ * @usage level_packer 工具静态调用；JSON 仍是关卡的编辑格式，关卡包是发布格式。
+ */
+class LevelPackWriter {
+public:
+    /**
+     * @brief 编码为关卡包字节
+     * @param levels 关卡列表 (顺序任意，关卡 ID 不可重复，桌面牌为空的关卡会被拒绝)
+     * @param out 输出字节
+     * @return bool 编码是否成功
+     */
+    static bool build(const std::vector<LevelConfig>& levels, std::vector<uint8_t>& out);
+
+    /**
+     * @brief 编码并写入文件
+     * @param levels 关卡列表
+     * @param filename 目标文件的完整路径
+     * @return bool 写入是否成功
+     */
+    static bool savePack(const std::vector<LevelConfig>& levels, const std::string& filename);
+};
@@ -1,37 +1,77 @@
 #include "GameController.h"
 #include "services/GameRuleService.h"
 #include "commands/MoveCardCommand.h"
-#include "configs/CardResConfig.h"
+#include "views/CardFrameRegistry.h"
 #include "configs/LevelConfigLoader.h"
 #include "services/GameModelGenerator.h"
 #include "commands/DrawCardCommand.h"
 #include "views/LevelSelectScene.h"
-#include "views/CardView.h" // ȷ CardView ͷļ
+#include "views/CardView.h" // 确保包含 CardView 头文件
+#include "views/CardViewPool.h"
 
 USING_NS_CC;
 
-// ͷ retain Ķ
+// 析构函数：必须释放 retain 的对象
+// View 通过 userObject 持有 Controller，Controller 只弱引用 View，避免循环引用导致整局对象无法释放
 GameController::~GameController() {
-    CC_SAFE_RELEASE(_gameView);
     CC_SAFE_RELEASE(_gameModel);
 }
 
 Scene* GameController::createGameScene(int levelId) {
+    return createGameScene(levelId, LevelConfig());
+}
+
+Scene* GameController::createGameScene(int levelId, const LevelConfig& config) {
+    auto scene = Scene::create();
+    auto view = GameView::create();
+    scene->addChild(view);
+
+    auto model = GameModel::create(); // 假设 GameModel 也是 Ref
+    auto controller = GameController::create(view, model);
+
+    if (controller) {
+        controller->_currentLevelId = levelId;
+        controller->_preloadedConfig = config;
+        controller->startGame();
+        view->setUserObject(controller);
+    }
+    return scene;
+}
+
+Scene* GameController::createEndlessScene(int levelId, const LevelConfig& config) {
     auto scene = Scene::create();
     auto view = GameView::create();
     scene->addChild(view);
 
-    auto model = GameModel::create(); //  GameModel Ҳ Ref
+    auto model = GameModel::create();
     auto controller = GameController::create(view, model);
 
     if (controller) {
         controller->_currentLevelId = levelId;
+        controller->_preloadedConfig = config;
+        controller->_endless = true;
         controller->startGame();
         view->setUserObject(controller);
     }
     return scene;
 }
 
+Scene* GameController::createResumedScene() {
+    SaveManager saveManager;
+    if (!saveManager.hasSave()) return nullptr;
+
+    auto scene = Scene::create();
+    auto view = GameView::create();
+    scene->addChild(view);
+
+    auto model = GameModel::create();
+    auto controller = GameController::create(view, model);
+    if (!controller || !controller->resumeGame()) return nullptr;
+
+    view->setUserObject(controller);
+    return scene;
+}
+
 GameController* GameController::create(GameView* view, GameModel* model) {
     GameController* ret = new (std::nothrow) GameController();
     if (ret && ret->init(view, model)) {
@@ -46,48 +86,155 @@ bool GameController::init(GameView* view, GameModel* model) {
     _gameView = view;
     _gameModel = model;
 
-    // ֶü (е release)
-    _gameView->retain();
+    // 手动管理引用计数 (配对析构函数中的 release)；View 反过来持有 Controller，这里不 retain
     _gameModel->retain();
 
+    // 撤销管理器只保存操作记录，执行/撤销/重做时按记录临时创建带动画的命令
     _undoManager = std::make_unique<UndoManager>();
+    _undoManager->setCommandFactory([view, model](const MoveRecord& record) -> std::unique_ptr<ICommand> {
+        if (record.type == MoveRecord::Draw) {
+            return std::make_unique<DrawCardCommand>(model, view, record);
+        }
+        return std::make_unique<MoveCardCommand>(model, view, record);
+        });
+
+    _saveManager = std::make_unique<SaveManager>();
+    _hintManager = std::make_unique<HintManager>();
     return true;
 }
 
-// --- ֳ̣Ĳ ---
+// --- 核心流程：被拆分成了三个清晰的步骤 ---
 
 void GameController::startGame() {
     CCLOG(">>> GameController: Start Game Flow");
 
-    // 1. 
+    // 1. 加载数据
     if (!_loadLevel()) {
-        return; // ʧ
+        return; // 加载失败
     }
 
-    // 2. 
+    // 2. 清理环境
     _gameView->clearBoard();
-    _undoManager->clear();
 
-    // 3. ʼڵϵ
+    // 3. 计算初始遮挡关系，并以初始局面作为历史起点
     GameRuleService::updateFaceUpStates(_gameModel);
+    _undoManager->reset(_gameModel);
+    _replayLog.reset(_currentLevelId, 0);   // 固定关卡没有发牌随机种子
 
-    // 4. ͼ
+    // 4. 创建视图 (视图按当前 Model 创建，此前的变更无需再刷新)
     _initCardViews();
     _initSceneUI();
+    _gameModel->clearChangedCards();
+
+    // 5. 写入初始存档，之后每步只追加日志
+    _bindSave();
+    _saveManager->writeSnapshot();
+
+    // 6. 开始为初始局面搜索提示
+    _blockerMasks = GameRuleService::buildBlockerMasks(_gameModel);
+    _requestHint();
+}
+
+bool GameController::resumeGame() {
+    CCLOG(">>> GameController: Resume Game Flow");
+
+    // 1. 一次读入存档：Model、历史与操作日志直接反序列化，不运行 GameModelGenerator
+    SaveContext context;
+    context.model = _gameModel;
+    context.history = &_undoManager->getHistory();
+    context.replayLog = &_replayLog;
+    if (!_saveManager->load(context)) {
+        CCLOG("!!! Error: Save is missing or corrupted");
+        return false;
+    }
+    _currentLevelId = context.levelId;
+    _endless = context.endless;
+    if (_endless) _layout = LevelConfigLoader::loadLevelById(_currentLevelId);
+
+    // 2. 创建视图
+    _gameView->clearBoard();
+    _undoManager->bindModel(_gameModel);
+    _initCardViews();
+    _initSceneUI();
+    _gameModel->clearChangedCards();
+
+    _blockerMasks = GameRuleService::buildBlockerMasks(_gameModel);
+    _requestHint();
+    return true;
+}
+
+void GameController::_bindSave() {
+    SaveContext context;
+    context.levelId = _currentLevelId;
+    context.endless = _endless;
+    context.model = _gameModel;
+    context.history = &_undoManager->getHistory();
+    context.replayLog = &_replayLog;
+    _saveManager->bind(context);
+}
+
+void GameController::_requestHint() {
+    // 搜索只读取局面拷贝，工作线程从不接触 GameModel
+    // 多副牌的局面 (卡牌 ID >= 52) 无法压缩，退化为按规则给出第一个合法操作
+    CompactGameState state;
+    if (!CompactGameState::fromModel(_gameModel, state)) {
+        _hintManager->publish(HintSearch::firstLegalMove(_gameModel));
+        return;
+    }
+    _hintManager->request(state, _blockerMasks);
 }
 
 bool GameController::_loadLevel() {
-    std::string filename = StringUtils::format("level_%d.json", _currentLevelId);
-    LevelConfig config = LevelConfigLoader::loadLevel(filename);
+    // 优先使用预加载的配置 (只用一次，重开本关时从关卡包或文件读取)
+    LevelConfig config = _preloadedConfig.isValid() ? std::move(_preloadedConfig) : LevelConfigLoader::loadLevelById(_currentLevelId);
+    _preloadedConfig = LevelConfig();
 
     if (!config.isValid()) {
-        CCLOG("!!! Error: Level config is invalid: %s", filename.c_str());
+        CCLOG("!!! Error: Level config is invalid: level %d", _currentLevelId);
         return false;
     }
 
-    // Generator  Config תΪ Model 
-    //  ID  drawStackIds (ǰ޸ Generator)
+    // Generator 负责将 Config 转化为 Model 数据
+    // 并将备用牌 ID 填入 drawStackIds (前提是您修复了 Generator)
     GameModelGenerator::generate(_gameModel, config);
+
+    // 无尽模式之后按同一布局发牌
+    if (_endless) _layout = std::move(config);
+    _retiredCardId = 0;
+    return true;
+}
+
+bool GameController::_dealNextDeck() {
+    if (!_layout.isValid()) return false;
+
+    // 1. 发牌种子由关卡与牌副序号决定，从存档恢复后仍发出相同的牌
+    int firstNewId = _gameModel->getDeckCount() * kCardsPerDeck;
+    uint64_t seed = ((uint64_t)(uint32_t)_currentLevelId << 32) | (uint32_t)_gameModel->getDeckCount();
+    int deck = GameModelGenerator::dealDeck(_gameModel, _layout.playfieldCards, _layout.coverGraph, seed);
+    if (deck < 0) return false;
+
+    // 2. 发牌后历史从新局面开始，底牌堆中已被压住的旧牌不会再被撤回，视图归还对象池
+    //    (只扫描上次发牌以来的 ID 段，当前堆顶留到下次发牌时再处理)
+    int topId = _gameModel->getTopCardId();
+    for (int id = _retiredCardId; id < firstNewId; ++id) {
+        auto card = _gameModel->getCardById(id);
+        if (card && card->getState() == CardState::Discard && id != topId) {
+            _gameView->removeCardView(id);
+        }
+    }
+    _retiredCardId = (topId >= _retiredCardId && topId < firstNewId) ? topId : firstNewId;
+
+    // 3. 只为新牌副创建视图
+    for (int id = firstNewId; id < firstNewId + kCardsPerDeck; ++id) {
+        _initCardView(_gameModel->getCardById(id));
+    }
+    _gameModel->clearChangedCards();
+
+    _undoManager->reset(_gameModel);
+    _saveManager->writeSnapshot();
+    _blockerMasks = GameRuleService::buildBlockerMasks(_gameModel);
+    _requestHint();
+    CCLOG(">>> Endless: dealt deck %d", deck);
     return true;
 }
 
@@ -95,182 +242,224 @@ void GameController::_initCardViews() {
     auto& allCards = _gameModel->getAllCards();
 
     for (auto card : allCards) {
-        if (card->getState() == CardState::Removed) continue;
+        _initCardView(card);
+    }
+}
 
-        // ͨ CardView
-        auto cardView = CardView::create(card);
+void GameController::_initCardView(CardModel* card) {
+    if (!card || card->getState() == CardState::Removed) return;
 
-        // ͨõ¼
-        cardView->setOnClickCallback([this](int id) {
-            this->handleCardClick(id);
-            });
+    // 从对象池取用 CardView (点击由 GameView 统一路由，见 _initSceneUI)
+    auto cardView = CardViewPool::acquire(card);
 
-        // ״̬λúͿɼ
-        if (card->getState() == CardState::Playfield) {
-            _gameView->addCardToLayer(cardView, card->getPosition(), card->getZOrder());
-        }
-        else if (card->getState() == CardState::Discard) {
-            // ʱҪʾ
-            _gameView->addCardToLayer(cardView, card->getPosition(), 0);
-        }
-        else if (card->getState() == CardState::Deck) {
-            // ƶѣڹ̶λ
-            cardView->setVisible(false);
-            // ŵ View ָĶѵλ ( View ṩӿڣʱӲ)
-            cardView->setPosition(Vec2(200, 300));
-            _gameView->addCardToLayer(cardView, Vec2(200, 300), 0);
-        }
+    // 根据状态设置位置和可见性
+    if (card->getState() == CardState::Playfield) {
+        _gameView->addCardToLayer(cardView, card->getPosition(), card->getZOrder());
+    }
+    else if (card->getState() == CardState::Discard) {
+        // 底牌暂时不需要点击，但显示出来；从存档恢复时可能有多张，堆顶放在最上层
+        int z = card->getId() == _gameModel->getTopCardId() ? 1 : 0;
+        _gameView->addCardToLayer(cardView, Vec2(540, 300), z);
+    }
+    else if (card->getState() == CardState::Deck) {
+        // 备用牌堆：隐藏在固定位置
+        cardView->setVisible(false);
+        // 放到 View 指定的堆叠位置 (建议 View 提供接口，这里暂时硬编码)
+        cardView->setPosition(Vec2(200, 300));
+        _gameView->addCardToLayer(cardView, Vec2(200, 300), 0);
     }
 }
 
 void GameController::_initSceneUI() {
-    // 1.  UNDO ť
-    // 飺View Ӧṩ addUndoButton ӿڣʱʵ
+    // 1. 创建 UNDO 按钮
+    // 建议：View 应该提供 addUndoButton 接口，这里暂时保留实现
     auto undoLabel = Label::createWithSystemFont("UNDO", "Arial", 60);
     undoLabel->enableOutline(Color4B::BLACK, 2);
     auto undoItem = MenuItemLabel::create(undoLabel, [this](Ref*) { this->handleUndo(); });
     undoItem->setPosition(Vec2(900, 200));
 
-    auto menu = Menu::create(undoItem, nullptr);
+    auto redoLabel = Label::createWithSystemFont("REDO", "Arial", 60);
+    redoLabel->enableOutline(Color4B::BLACK, 2);
+    auto redoItem = MenuItemLabel::create(redoLabel, [this](Ref*) { this->handleRedo(); });
+    redoItem->setPosition(Vec2(900, 100));
+
+    auto hintLabel = Label::createWithSystemFont("HINT", "Arial", 60);
+    hintLabel->enableOutline(Color4B::BLACK, 2);
+    auto hintItem = MenuItemLabel::create(hintLabel, [this](Ref*) { this->handleHint(); });
+    hintItem->setPosition(Vec2(900, 300));
+
+    auto menu = Menu::create(undoItem, redoItem, hintItem, nullptr);
     menu->setPosition(Vec2::ZERO);
     _gameView->addChild(menu, 1000);
 
-    // 2.  ƶѵ (Draw Pile)
-    // һ߼ĴһԶڱ Sprite
-    std::string backPath = CardResConfig::getBackImagePath();
-    auto drawPile = Sprite::create(backPath);
+    // 2. 创建 牌堆点击区域 (Draw Pile)
+    // 这是一个纯逻辑的触摸区，或者一个永远在背面的 Sprite
+    // 与桌面卡牌共用图集纹理，保持合批
+    auto backFrame = CardFrameRegistry::getBackFrame();
+    auto drawPile = backFrame ? Sprite::createWithSpriteFrame(backFrame) : nullptr;
     if (drawPile) {
         drawPile->setPosition(Vec2(200, 300));
-        // ߼
+        // 缩放逻辑
         if (drawPile->getContentSize().width > 0) {
             drawPile->setScale(180.0f / drawPile->getContentSize().width);
         }
-        _gameView->addChild(drawPile, -1);
-
-        // 󶨼
-        auto listener = EventListenerTouchOneByOne::create();
-        listener->setSwallowTouches(true);
-        listener->onTouchBegan = [drawPile](Touch* t, Event* e) {
-            Vec2 p = drawPile->convertToNodeSpace(t->getLocation());
-            Rect rect = Rect(0, 0, drawPile->getContentSize().width, drawPile->getContentSize().height);
-            return rect.containsPoint(p);
-            };
-        listener->onTouchEnded = [this](Touch* t, Event* e) {
-            this->handleDrawPileClick();
-            };
-        Director::getInstance()->getEventDispatcher()->addEventListenerWithSceneGraphPriority(listener, drawPile);
+        _gameView->setDrawPile(drawPile, [this]() { this->handleDrawPileClick(); });
     }
+
+    // 3. 棋盘点击：GameView 只注册一个监听器，命中测试后回调被点中的最上层卡牌
+    _gameView->setOnCardClickCallback([this](int id) {
+        this->handleCardClick(id);
+        });
 }
 
-// --- ҵ߼ ---
+// --- 业务逻辑 ---
 
 void GameController::handleCardClick(int cardId) {
     auto clickedCard = _gameModel->getCardById(cardId);
     int currentBaseId = _gameModel->getTopCardId();
     auto baseCard = _gameModel->getCardById(currentBaseId);
 
-    // Լ
+    // 防御性检查
     if (!clickedCard || !baseCard) return;
-    if (!clickedCard->isFaceUp()) return; // Ʋɵ
+    if (!clickedCard->isFaceUp()) return; // 背面牌不可点
 
-    // ж
+    // 规则判定
     if (GameRuleService::canMatch(clickedCard, baseCard)) {
-        // ƶ
-        Vec2 fromPos = clickedCard->getPosition();
-        Vec2 toPos = Vec2(540, 300); //  View ȡλ
-
-        // ؼOldTopId  baseCard  ID
-        auto cmd = std::make_unique<MoveCardCommand>(
-            _gameModel, _gameView,
-            cardId, baseCard->getId(),
-            fromPos, toPos
-        );
-        _undoManager->addCommand(std::move(cmd));
+        // 关键：prevTopId 必须是 baseCard 的 ID
+        MoveRecord record = MoveRecord::makeMove(cardId, baseCard->getId(), clickedCard->getState());
+        _undoManager->execute(record);
+        _replayLog.recordClick(cardId);
+        _saveManager->appendExecute(record);
+        _requestHint();
 
         refreshBoardState();
         checkGameState();
     }
     else {
-        // ѡ Shake 
+        // 可选：播放 Shake 动画
         CCLOG(">>> No Match!");
     }
 }
 
 void GameController::handleDrawPileClick() {
-    int nextCardId = _gameModel->popNextDrawCard();
-    if (nextCardId == -1) {
+    // 只预览下一张，出牌由执行命令时完成 (重做时同样适用)
+    int count = 0;
+    const int* next = _gameModel->peekNextDrawCards(1, count);
+    if (count == 0) {
         CCLOG(">>> Deck is empty");
         return;
     }
 
-    int currentTopId = _gameModel->getTopCardId();
-    auto cmd = std::make_unique<DrawCardCommand>(
-        _gameModel, _gameView,
-        nextCardId, currentTopId
-    );
-    _undoManager->addCommand(std::move(cmd));
+    MoveRecord record = MoveRecord::makeDraw(next[0], _gameModel->getTopCardId());
+    _undoManager->execute(record);
+    _replayLog.recordDraw();
+    _saveManager->appendExecute(record);
+    _requestHint();
+    refreshBoardState();
 
-    // ƿܵϷʧܣûûˣ
+    // 发牌可能导致游戏失败（如果没有牌了且没步数了）
     checkGameState();
 }
 
+void GameController::handleHint() {
+    // 只读取已发布的结果，不等待后台搜索
+    HintResult hint;
+    if (!_hintManager->getHint(hint)) {
+        CCLOG(">>> Hint is not ready yet");
+        return;
+    }
+    if (!hint.valid) {
+        CCLOG(">>> No move available");
+        return;
+    }
+    _gameView->showHint(hint.isDraw ? -1 : hint.cardId);
+}
+
 void GameController::handleUndo() {
-    if (_undoManager) {
-        _undoManager->undo();
+    if (_undoManager && _undoManager->undo()) {
+        _replayLog.recordUndo();
+        _saveManager->appendUndo();
+        _requestHint();
         refreshBoardState();
     }
 }
 
-void GameController::refreshBoardState() {
-    // 1. ߼
-    GameRuleService::updateFaceUpStates(_gameModel);
+void GameController::handleRedo() {
+    if (_undoManager && _undoManager->redo()) {
+        _replayLog.recordRedo();
+        _saveManager->appendRedo();
+        _requestHint();
+        refreshBoardState();
+        checkGameState();
+    }
+}
 
-    // 2. ͼ
-    auto& allCards = _gameModel->getAllCards();
-    for (auto card : allCards) {
-        if (card->getState() == CardState::Playfield) {
-            auto cardView = _gameView->getCardViewById(card->getId());
-            if (cardView) cardView->updateView();
-        }
+void GameController::refreshBoardState() {
+    // 翻面状态已由命令在执行/撤销时增量更新并记入变更集，这里只同步受影响的桌面牌
+    // (离开桌面的牌由补间落位时按 CardTweenSystem::RefreshView 刷新)
+    for (int cardId : _gameModel->getChangedCardIds()) {
+        auto card = _gameModel->getCardById(cardId);
+        if (!card || card->getState() != CardState::Playfield) continue;
+
+        auto cardView = _gameView->getCardViewById(cardId);
+        if (cardView) cardView->updateView();
     }
+    _gameModel->clearChangedCards();
 }
 
 void GameController::checkGameState() {
-    // 1. ʤж
+    // 1. 胜利判定 (无尽模式下桌面清空即发下一副牌，发不出时才算胜利)
     if (_gameModel->getPlayfieldCardCount() == 0) {
+        if (_endless && _dealNextDeck()) return;
         showGameOverUI(true);
         return;
     }
 
-    // 2. ʧж (ƿ  ·)
-    // Żֱӱ View Model 
+    // 2. 失败判定 (备用牌空 且 无路可走)
+    // 优化：不直接遍历 View，而是信任 Model 数据
     if (_gameModel->getDrawStackSize() == 0 && !GameRuleService::hasAnyMove(_gameModel)) {
         showGameOverUI(false);
     }
 }
 
 void GameController::showGameOverUI(bool win) {
-    // һ View ߼ʱͨ֯
+    // 保存本局操作日志，胜利时可随成绩上传供服务端回放校验
+    // (无尽模式的发牌不在日志中，回放无法校验，不保存)
+    if (!_endless) {
+        std::string replayPath = FileUtils::getInstance()->getWritablePath()
+            + StringUtils::format("replay_level_%d.bin", _currentLevelId);
+        _replayLog.saveToFile(replayPath);
+    }
+
+    // 对局已结束，下次启动不再恢复，也不再需要提示
+    _saveManager->remove();
+    _hintManager->clear();
+
+    // 这是一个 View 层的逻辑，但暂时放在这里，通过辅助代码组织
     auto mask = LayerColor::create(Color4B(0, 0, 0, 150));
     _gameView->addChild(mask, 2000);
 
-    // ε
+    // 屏蔽点击
     auto listener = EventListenerTouchOneByOne::create();
     listener->setSwallowTouches(true);
     listener->onTouchBegan = [](Touch*, Event*) { return true; };
     Director::getInstance()->getEventDispatcher()->addEventListenerWithSceneGraphPriority(listener, mask);
 
-    // 
+    // 标题
     auto label = Label::createWithSystemFont(win ? "YOU WIN!" : "GAME OVER", "Arial", 100);
-    label->setPosition(Vec2(540, 1200)); // ʹ _gameView->getContentSize().width / 2
+    label->setPosition(Vec2(540, 1200)); // 建议使用 _gameView->getContentSize().width / 2
     label->setColor(win ? Color3B::YELLOW : Color3B::GRAY);
     mask->addChild(label);
 
-    // ˵
+    // 菜单
     auto replayItem = MenuItemLabel::create(
         Label::createWithSystemFont("REPLAY", "Arial", 50),
         [this](Ref*) {
-            Director::getInstance()->replaceScene(GameController::createGameScene(_currentLevelId));
+            // 新场景在旧场景销毁前创建，先把卡牌视图归还对象池供新棋盘复用
+            _gameView->clearBoard();
+            Director::getInstance()->replaceScene(_endless
+                ? GameController::createEndlessScene(_currentLevelId)
+                : GameController::createGameScene(_currentLevelId));
         }
     );
     replayItem->setPosition(Vec2(340, 600));
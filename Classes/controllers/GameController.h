@@ -3,101 +3,180 @@
 #include "models/GameModel.h"
 #include "views/GameView.h"
 #include "managers/UndoManager.h"
+#include "managers/SaveManager.h"
+#include "managers/HintManager.h"
+#include "models/ReplayLog.h"
+#include "configs/LevelConfig.h"
 
 /**
  * @class GameController
- * @brief ϷĿ
- * @responsibility Э Model  Viewû룬Ϸ̣ʼж
- * @usage  Scene УͨصӦ View Ľ
+ * @brief 游戏核心控制器
+ * @responsibility 协调 Model 和 View，处理用户输入，管理游戏流程（开始、结束、判定）。
+ * @usage 由 Scene 创建并持有，通过回调响应 View 的交互。
  */
 class GameController : public cocos2d::Ref {
 public:
     /**
-     * @brief ͷųе Model  View
+     * @brief 析构函数，负责释放持有的 Model
      */
     virtual ~GameController();
 
     /**
-     * @brief װϷ
-     * @param levelId ؿ ID
-     * @return cocos2d::Scene*  View  Controller 
+     * @brief 工厂方法：创建并组装游戏场景
+     * @param levelId 关卡 ID
+     * @return cocos2d::Scene* 包含 View 和 Controller 的完整场景
      */
     static cocos2d::Scene* createGameScene(int levelId);
 
     /**
-     * @brief ʵ
+     * @brief 工厂方法：使用已预加载的关卡配置创建游戏场景 (不再读取文件)
+     * @param levelId 关卡 ID
+     * @param config 由 LevelPreloader 解析好的配置
+     */
+    static cocos2d::Scene* createGameScene(int levelId, const LevelConfig& config);
+
+    /**
+     * @brief 工厂方法：创建无尽模式场景
+     * 以该关卡的桌面布局开局，桌面清空后按同一布局发出一副新洗好的牌，直到无路可走。
+     * @param levelId 提供布局的关卡 ID
+     * @param config 已预加载的关卡配置 (无效时从关卡包或文件读取)
+     */
+    static cocos2d::Scene* createEndlessScene(int levelId, const LevelConfig& config = LevelConfig());
+
+    /**
+     * @brief 工厂方法：从存档恢复上一局
+     * @return cocos2d::Scene* 没有可用存档时返回 nullptr
+     */
+    static cocos2d::Scene* createResumedScene();
+
+    /**
+     * @brief 创建控制器实例
      */
     static GameController* create(GameView* view, GameModel* model);
 
     /**
-     * @brief Ϸ̣ʼϷ
-     * áʼݺͼ
+     * @brief 游戏流程：开始游戏
+     * 加载配置、初始化数据和视图。
      */
     void startGame();
 
-    // ---  ---
+    /**
+     * @brief 游戏流程：从存档恢复
+     * 读取存档、恢复数据和历史并初始化视图。
+     * @return bool 存档不存在或损坏时返回 false
+     */
+    bool resumeGame();
+
+    // --- 交互处理 ---
 
     /**
-     * @brief Ƶ¼
-     * @param cardId Ŀ ID
+     * @brief 处理卡牌点击事件
+     * @param cardId 被点击的卡牌 ID
      */
     void handleCardClick(int cardId);
 
     /**
-     * @brief (Undo)ť
+     * @brief 处理回退(Undo)按钮点击
      */
     void handleUndo();
 
     /**
-     * @brief ƶ(Draw Pile)
-     * ƶѳȡһƵ
+     * @brief 处理重做(Redo)按钮点击
+     * 重新执行最近一次被撤销的操作。
+     */
+    void handleRedo();
+
+    /**
+     * @brief 处理备用牌堆(Draw Pile)点击
+     * 从牌堆抽取一张新牌到底牌区。
      */
     void handleDrawPileClick();
 
-    // --- ״̬ ---
+    /**
+     * @brief 处理提示(Hint)按钮点击
+     * 读取后台搜索最近完成的结果并高亮建议的卡牌或牌堆；当前局面仍在搜索时不做任何事。
+     */
+    void handleHint();
+
+    // --- 状态管理 ---
 
     /**
-     * @brief Ϸʤ״̬
-     * ÿá
+     * @brief 检查游戏胜负状态
+     * 在每步操作后调用。
      */
     void checkGameState();
 
     /**
-     * @brief ʾϷ
-     * @param win trueΪʤfalseΪʧ
+     * @brief 显示游戏结束结算界面
+     * @param win true为胜利，false为失败
      */
     void showGameOverUI(bool win);
 
+    /**
+     * @brief 获取本局的操作日志 (只包含实际生效的操作)
+     */
+    const ReplayLog& getReplayLog() const { return _replayLog; }
+
 private:
     bool init(GameView* view, GameModel* model);
 
     /**
-     * @brief ˢ״̬
-     * ¼ڵϵͼʾ
+     * @brief 刷新棋盘状态
+     * 只刷新 Model 变更集中仍在桌面上的卡牌，然后清空变更集；每步的开销与受影响的牌数成正比。
      */
     void refreshBoardState();
 
-    // --- ˽и (ڲֹ߼) ---
+    // --- 私有辅助函数 (用于拆分过长的逻辑) ---
 
     /**
-     * @brief عؿò Model 
-     * @return bool Ƿسɹ
+     * @brief 加载关卡配置并生成 Model 数据
+     * @return bool 是否加载成功
      */
     bool _loadLevel();
 
     /**
-     * @brief  Model ʼпƵͼ
+     * @brief 根据 Model 初始化所有卡牌的视图
      */
     void _initCardViews();
 
     /**
-     * @brief ʼUI (Undoťƶѽ)
+     * @brief 为单张卡牌创建视图并按其状态摆放 (Removed 的牌不创建)
+     */
+    void _initCardView(CardModel* card);
+
+    /**
+     * @brief 无尽模式：按关卡布局发出下一副牌
+     * 发牌后以新局面作为历史起点，已压在底牌下的旧牌视图归还对象池。
+     * @return bool 没有布局或牌副数已达上限时返回 false
+     */
+    bool _dealNextDeck();
+
+    /**
+     * @brief 初始化场景UI (Undo/Redo按钮、牌堆交互区)
      */
     void _initSceneUI();
 
-    // Ա
-    GameView* _gameView;            ///< Ϸͼ
-    GameModel* _gameModel;          ///< Ϸ
-    int _currentLevelId;            ///< ǰؿ ID
-    std::unique_ptr<UndoManager> _undoManager; ///< 
+    /**
+     * @brief 将当前对局数据绑定到存档管理器
+     */
+    void _bindSave();
+
+    /**
+     * @brief 把当前局面的拷贝提交给提示引擎 (每次局面变化后调用)
+     */
+    void _requestHint();
+
+    // 成员变量
+    GameView* _gameView;            ///< 游戏视图 (弱引用，View 通过 userObject 持有本对象)
+    GameModel* _gameModel;          ///< 游戏数据引用
+    int _currentLevelId;            ///< 当前关卡 ID
+    LevelConfig _preloadedConfig;   ///< 预加载的关卡配置 (无效时从文件读取)
+    std::unique_ptr<UndoManager> _undoManager; ///< 撤销管理器
+    ReplayLog _replayLog;           ///< 本局操作日志 (用于回放校验)
+    std::unique_ptr<SaveManager> _saveManager; ///< 存档管理器 (快照 + 增量日志)
+    std::unique_ptr<HintManager> _hintManager; ///< 后台提示引擎
+    BlockerMasks _blockerMasks = {};            ///< 本关静态遮挡表 (提交提示搜索时拷贝)
+    bool _endless = false;          ///< 是否为无尽模式
+    LevelConfig _layout;            ///< 无尽模式的发牌布局 (关卡配置)
+    int _retiredCardId = 0;         ///< 该 ID 之前的底牌堆旧牌视图已归还对象池
 };
\ No newline at end of file
@@ -0,0 +1,114 @@
+#include "LevelPreloader.h"
+#include "configs/LevelConfigLoader.h"
+#include "views/CardFrameRegistry.h"
+
+USING_NS_CC;
+
+LevelPreloader::~LevelPreloader() {
+    for (auto& entry : _levels) {
+        if (entry.second.future.valid()) entry.second.future.wait();
+    }
+}
+
+void LevelPreloader::preloadTextures() {
+    if (_texturesRequested) return;
+    _texturesRequested = true;
+
+    // 回调在主线程执行，但可能晚于本对象析构，因此只写共享的完成标记，不捕获 this
+    // 加载失败也视为完成：进入游戏后 CardView 会同步重试并回退到单张图片
+    auto done = std::make_shared<bool>(false);
+    _texturesDone = done;
+    CardFrameRegistry::loadAsync(Director::getInstance()->getContentScaleFactor(), [done](bool ok) {
+        if (!ok) CCLOG("LevelPreloader: card textures failed to load");
+        *done = true;
+    });
+    _texturesReady = *done;
+}
+
+void LevelPreloader::preloadLevel(int levelId) {
+    if (_levels.count(levelId)) return;
+
+    // 关卡包已打开且包含该关卡：只需拷贝记录并构建遮挡关系，同样放到工作线程
+    LevelTask& task = _levels[levelId];
+    if (LevelConfigLoader::getPack().hasLevel(levelId)) {
+        task.future = std::async(std::launch::async, [levelId]() {
+            return LevelConfigLoader::getPack().getLevel(levelId).toLevelConfig();
+        }).share();
+        return;
+    }
+
+    // FileUtils 的路径缓存不是线程安全的：先在主线程解析出绝对路径，工作线程只做读取与解析
+    std::string filename = StringUtils::format("level_%d.json", levelId);
+    std::string fullPath = FileUtils::getInstance()->fullPathForFilename(filename);
+
+    if (fullPath.empty()) {
+        CCLOG("LevelPreloader: level file not found: %s", filename.c_str());
+        std::promise<LevelConfig> missing;
+        missing.set_value(LevelConfig());
+        task.future = missing.get_future().share();
+        return;
+    }
+
+    task.future = std::async(std::launch::async, [fullPath]() {
+        return LevelConfigLoader::loadLevel(fullPath);
+    }).share();
+}
+
+std::shared_future<LevelConfig> LevelPreloader::getLevelFuture(int levelId) {
+    preloadLevel(levelId);
+    return _levels[levelId].future;
+}
+
+bool LevelPreloader::isReady(int levelId) const {
+    auto it = _levels.find(levelId);
+    return _texturesReady && it != _levels.end() && it->second.parsed;
+}
+
+void LevelPreloader::whenReady(int levelId, const std::function<void(const LevelConfig&)>& callback) {
+    preloadTextures();
+    preloadLevel(levelId);
+    _levels[levelId].onReady = callback;
+}
+
+float LevelPreloader::getProgress() const {
+    int total = (_texturesRequested ? 1 : 0) + (int)_levels.size();
+    if (total == 0) return 0.0f;
+
+    int done = _texturesReady ? 1 : 0;
+    for (const auto& entry : _levels) {
+        if (entry.second.parsed) done++;
+    }
+    return (float)done / total;
+}
+
+void LevelPreloader::update() {
+    // 1. 收取状态 (纹理回调由 TextureCache 在主线程派发，这里只需读取完成标记)
+    if (_texturesDone && !_texturesReady) {
+        _texturesReady = *_texturesDone;
+    }
+    for (auto& entry : _levels) {
+        LevelTask& task = entry.second;
+        if (!task.parsed && task.future.wait_for(std::chrono::seconds(0)) == std::future_status::ready) {
+            task.parsed = true;
+        }
+    }
+
+    // 2. 进度有变化时通知
+    float progress = getProgress();
+    if (_onProgress && progress != _lastProgress) {
+        _onProgress(progress);
+    }
+    _lastProgress = progress;
+
+    // 3. 派发就绪回调 (先取出再调用，回调中可能切换场景并销毁本对象)
+    if (!_texturesReady) return;
+    for (auto& entry : _levels) {
+        LevelTask& task = entry.second;
+        if (task.parsed && task.onReady) {
+            auto callback = std::move(task.onReady);
+            task.onReady = nullptr;
+            callback(task.future.get());
+            return;
+        }
+    }
+}
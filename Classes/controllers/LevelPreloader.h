@@ -0,0 +1,88 @@
+#pragma once
+#include "cocos2d.h"
+#include "configs/LevelConfig.h"
+#include <functional>
+#include <future>
+#include <map>
+#include <memory>
+#include <vector>
+
+/**
+ * @class LevelPreloader
+ * @brief 关卡与卡牌纹理的异步预加载器
+ * @responsibility 在工作线程中读取并解析关卡 JSON，同时通过 TextureCache::addImageAsync 解码卡牌纹理；
+ *                 两者都就绪后在主线程通知调用方，使游戏场景构建时不再有文件 I/O 与图片解码。
+ * @usage 关卡列表显示 (或按钮按下) 时调用 preloadTextures / preloadLevel；whenReady 注册切换场景的回调；
+ *        持有者需每帧调用 update() 以在主线程派发进度与完成回调。
+ */
+class LevelPreloader {
+public:
+    /**
+     * @brief 进度回调
+     * @param progress 已就绪的任务占全部已提交任务的比例 [0, 1]
+     */
+    using ProgressCallback = std::function<void(float progress)>;
+
+    /**
+     * @brief 析构时等待仍在运行的解析任务结束 (任务很短，不会明显阻塞)
+     */
+    ~LevelPreloader();
+
+    /**
+     * @brief 开始异步解码卡牌纹理 (重复调用无效果)
+     */
+    void preloadTextures();
+
+    /**
+     * @brief 开始在工作线程解析关卡 (同一关卡重复调用无效果)
+     * @param levelId 关卡 ID，对应 level_<id>.json
+     */
+    void preloadLevel(int levelId);
+
+    /**
+     * @brief 获取关卡解析结果的 future
+     * 未调用过 preloadLevel 时会先提交解析任务。
+     */
+    std::shared_future<LevelConfig> getLevelFuture(int levelId);
+
+    /**
+     * @brief 关卡配置与卡牌纹理是否都已就绪
+     */
+    bool isReady(int levelId) const;
+
+    /**
+     * @brief 关卡就绪后在主线程回调 (已就绪时在下一次 update 中回调)
+     * 会自动提交该关卡与纹理的预加载。同一关卡只保留最后一次注册的回调。
+     * @param callback 参数为解析好的关卡配置 (解析失败时 isValid() 为 false)
+     */
+    void whenReady(int levelId, const std::function<void(const LevelConfig&)>& callback);
+
+    void setProgressCallback(const ProgressCallback& callback) { _onProgress = callback; }
+
+    /**
+     * @brief 当前进度 [0, 1]
+     */
+    float getProgress() const;
+
+    /**
+     * @brief 主线程轮询：收取已完成的解析任务，派发进度与就绪回调
+     */
+    void update();
+
+private:
+    /**
+     * @brief 单个关卡的预加载状态
+     */
+    struct LevelTask {
+        std::shared_future<LevelConfig> future;
+        bool parsed = false;                                ///< future 已完成 (主线程确认)
+        std::function<void(const LevelConfig&)> onReady;    ///< 等待中的就绪回调
+    };
+
+    std::map<int, LevelTask> _levels;
+    bool _texturesRequested = false;
+    bool _texturesReady = false;
+    std::shared_ptr<bool> _texturesDone;    ///< 纹理加载完成标记 (与异步回调共享)
+    ProgressCallback _onProgress;
+    float _lastProgress = -1.0f;
+};
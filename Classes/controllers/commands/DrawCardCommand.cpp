@@ -2,72 +2,62 @@
 
 USING_NS_CC;
 
-DrawCardCommand::DrawCardCommand(GameModel* model, GameView* view, int cardId, int oldTopCardId)
-    : _model(model), _view(view), _cardId(cardId), _oldTopCardId(oldTopCardId)
+DrawCardCommand::DrawCardCommand(GameModel* model, GameView* view, const MoveRecord& record)
+    : _model(model), _view(view), _record(record)
 {
+    // 一次性解析句柄，execute/undo 中不再按 ID 查询
+    _card = _model->getCardById(_record.cardId);
+    _cardView = _view->getCardViewById(_record.cardId);
+    _oldTopView = _view->getCardViewById(_record.prevTopId);
 }
 
 void DrawCardCommand::execute() {
-    auto card = _model->getCardById(_cardId);
+    auto card = _card;
     if (!card) return;
 
-    // 1. ݱƶƵΪ
-    card->setState(CardState::Discard);
-    card->setFaceUp(true);
-    _model->setTopCardId(_cardId);
+    // 1. 数据变更：从牌堆队首移到底牌区，并设为正面
+    GameHistory::applyMove(_model, _record);
 
-    // 2. ͼĿ㼶
+    // 2. 视图变更：计算目标层级
     int targetZ = 10;
-    auto oldBaseView = _view->getCardViewById(_oldTopCardId);
-    if (oldBaseView) {
-        // ֤ھ
-        targetZ = oldBaseView->getLocalZOrder() + 1;
+    if (_oldTopView) {
+        // 保证新牌在旧牌上面
+        targetZ = _oldTopView->getLocalZOrder() + 1;
     }
 
-    auto cardView = _view->getCardViewById(_cardId);
+    auto cardView = _cardView;
     if (cardView) {
-        // ؼ״̬лӲɼ(Deck)Ϊɼ
+        // 关键状态切换：从不可见(Deck)变为可见
         cardView->setVisible(true);
-        cardView->updateView(); // ˢͼ
+        cardView->updateView(); // 刷新贴图
 
-        // Ϊ߲㼶ֹ
+        // 动画过程设为高层级，防止穿插
         cardView->setLocalZOrder(100);
 
-        _view->playMoveCardAnim(_cardId, kDiscardPilePos, [cardView, targetZ]() {
-            // 趨ΪȷĶѵ㼶
-            cardView->setLocalZOrder(targetZ);
-            });
+        // 动画结束后，设定为正确的堆叠层级
+        _view->playMoveCardAnim(_record.cardId, kDiscardPilePos, targetZ);
     }
 
-    CCLOG("CMD: Draw Card %d", _cardId);
+    CCLOG("CMD: Draw Card %d", _record.cardId);
 }
 
 void DrawCardCommand::undo() {
-    auto card = _model->getCardById(_cardId);
+    auto card = _card;
     if (!card) return;
 
-    // 1. ݻָ˵ƶ
-    card->setState(CardState::Deck);
-    card->setFaceUp(false);
+    // 1. 数据恢复：回退到牌堆顶部，恢复旧的 Top ID
+    GameHistory::revertMove(_model, _record);
 
-    // ָɵ Top ID
-    _model->setTopCardId(_oldTopCardId);
-
-    // ߼ ID ƶеͷ (Model ޸߼)
-    _model->pushBackToDrawStackTop(_cardId);
-
-    // 2. ͼָɻ½
-    auto cardView = _view->getCardViewById(_cardId);
+    // 2. 视图恢复：飞回左下角
+    auto cardView = _cardView;
     if (cardView) {
-        // ָ߲㼶
+        // 保持高层级飞行
         cardView->setLocalZOrder(100);
 
-        _view->playMoveCardAnim(_cardId, kDeckPilePos, [cardView]() {
-            cardView->updateView(); // ر
-            // ؼɻغΪɼģ⡰ƶѡ
-            cardView->setVisible(false);
-            });
+        // 飞回后变回背面并设为不可见，模拟“进入牌堆”
+        _view->playMoveCardAnim(_record.cardId, kDeckPilePos, CardTweenSystem::kKeepZOrder,
+            CardTweenSystem::RefreshView | CardTweenSystem::Hide);
     }
 
-    CCLOG("CMD: Undo Draw Card %d", _cardId);
+    CCLOG("CMD: Undo Draw Card %d", _record.cardId);
 }
\ No newline at end of file
@@ -1,44 +1,47 @@
 #pragma once
 #include "managers/ICommand.h"
+#include "managers/GameHistory.h"
 #include "models/GameModel.h"
 #include "views/GameView.h"
 
 /**
  * @class DrawCardCommand
- * @brief 
- * @responsibility ӱƶ(Deck)ȡһƵƶ(Discard)߼䳷
- * @usage ûƶʱִС
+ * @brief 翻牌命令
+ * @responsibility 处理从备用牌堆(Deck)抽取一张牌到底牌堆(Discard)的逻辑及其撤销。
+ * @usage 由 UndoManager 的命令工厂按 MoveRecord 临时创建；数据变更委托给 GameHistory，本类只负责动画。
  */
 class DrawCardCommand : public ICommand {
 public:
     /**
-     * @brief 캯
-     * @param model ģ
-     * @param view ͼ
-     * @param cardId  ID
-     * @param oldTopCardId ǰƶѶ ID (ڼ㼶)
+     * @brief 构造函数
+     * @param model 数据模型
+     * @param view 视图引用
+     * @param record 操作记录 (type 为 MoveRecord::Draw，prevTopId 用于计算层级)
      */
-    DrawCardCommand(GameModel* model, GameView* view, int cardId, int oldTopCardId);
+    DrawCardCommand(GameModel* model, GameView* view, const MoveRecord& record);
 
     /**
-     * @brief ִз
-     * ƴ Deck  Discardŷƶ
+     * @brief 执行翻牌
+     * 将牌从 Deck 移至 Discard，并播放翻牌动画。
      */
     void execute() override;
 
     /**
-     * @brief 
-     * ƷŻ Deck ָ״̬
+     * @brief 撤销翻牌
+     * 将牌放回 Deck 顶部，恢复隐形状态。
      */
     void undo() override;
 
 private:
     GameModel* _model;
     GameView* _view;
-    int _cardId;       ///< ĿID
-    int _oldTopCardId; ///< ɵĶѶID
+    CardModel* _card;       ///< 被操作的卡牌 (构造时解析的句柄)
+    CardView* _cardView;    ///< 被操作卡牌的视图
+    CardView* _oldTopView;  ///< 旧堆顶的视图
 
-    // 飺Ӧ Config ṩʱΪ˽г
+    MoveRecord _record;     ///< 操作记录 (牌 ID、旧堆顶 ID)
+
+    // 建议：坐标应由 Config 提供，这里暂时作为私有常量
     const cocos2d::Vec2 kDiscardPilePos = cocos2d::Vec2(540, 300);
     const cocos2d::Vec2 kDeckPilePos = cocos2d::Vec2(200, 300);
 };
\ No newline at end of file
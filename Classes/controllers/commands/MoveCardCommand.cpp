@@ -2,72 +2,57 @@
 
 USING_NS_CC;
 
-MoveCardCommand::MoveCardCommand(GameModel* model, GameView* view,
-    int cardId, int oldTopCardId,
-    Vec2 fromPos, Vec2 toPos)
-    : _model(model), _view(view),
-    _cardId(cardId), _oldTopCardId(oldTopCardId),
-    _fromPos(fromPos), _toPos(toPos)
+MoveCardCommand::MoveCardCommand(GameModel* model, GameView* view, const MoveRecord& record)
+    : _model(model), _view(view), _record(record)
 {
-    // ֻ¼߼״̬¼ View  ZOrder
-    auto card = _model->getCardById(_cardId);
-    if (card) {
-        _prevState = card->getState();
-    }
+    // 一次性解析句柄，execute/undo 及动画回调中不再按 ID 查询
+    _card = _model->getCardById(_record.cardId);
+    _cardView = _view->getCardViewById(_record.cardId);
+    _oldTopView = _view->getCardViewById(_record.prevTopId);
+
+    // 桌面牌位置在关卡内不变，飞回时直接使用
+    _fromPos = _card ? _card->getPosition() : Vec2::ZERO;
 }
 
 void MoveCardCommand::execute() {
-    auto card = _model->getCardById(_cardId);
-    if (!card) return;
+    if (!_card) return;
 
-    // 1. ݱ
-    card->setState(CardState::Discard);
-    _model->setTopCardId(_cardId);
+    // 1. 数据变更 (与无界面回放共用同一套规则)
+    GameHistory::applyMove(_model, _record);
 
-    // 2. ͼ
+    // 2. 视图表现
     int targetZ = 10;
-    auto oldBaseView = _view->getCardViewById(_oldTopCardId);
-    if (oldBaseView) {
-        targetZ = oldBaseView->getLocalZOrder() + 1;
+    if (_oldTopView) {
+        targetZ = _oldTopView->getLocalZOrder() + 1;
     }
 
-    auto cardView = _view->getCardViewById(_cardId);
+    auto cardView = _cardView;
     if (cardView) {
-        // ʱΪߣֹڵ
+        // 飞行时设为最高，防止被其他牌遮挡
         cardView->setLocalZOrder(1000);
     }
 
-    // Ŷ
-    _view->playMoveCardAnim(_cardId, _toPos, [this, targetZ]() {
-        auto v = _view->getCardViewById(_cardId);
-        // ΪƶѵĲ㼶
-        if (v) v->setLocalZOrder(targetZ);
-        });
+    // 播放动画，结束后设置为底牌堆叠的层级 (收尾参数随动画提交，命令被撤销销毁后也不会悬空)
+    _view->playMoveCardAnim(_record.cardId, kDiscardPilePos, targetZ);
 
-    CCLOG("CMD: Move Card %d -> Discard", _cardId);
+    CCLOG("CMD: Move Card %d -> Discard", _record.cardId);
 }
 
 void MoveCardCommand::undo() {
-    auto card = _model->getCardById(_cardId);
-    if (!card) return;
+    if (!_card) return;
 
-    // 1. ݻָ
-    card->setState(_prevState);
-    _model->setTopCardId(_oldTopCardId);
+    // 1. 数据恢复
+    GameHistory::revertMove(_model, _record);
 
-    // 2. ͼָ
-    auto cardView = _view->getCardViewById(_cardId);
+    // 2. 视图恢复
+    auto cardView = _cardView;
     if (cardView) {
-        // ʱʱȨ
+        // 飞行时临时提权
         cardView->setLocalZOrder(1000);
     }
 
-    // 3. ɻ
-    _view->playMoveCardAnim(_cardId, _fromPos, [this, card, cardView]() {
-        if (cardView && card) {
-            cardView->setLocalZOrder(card->getZOrder());
-        }
-        });
+    // 3. 动画飞回，落位后恢复桌面上的原始层级
+    _view->playMoveCardAnim(_record.cardId, _fromPos, _card->getZOrder());
 
-    CCLOG("CMD: Undo Move Card %d", _cardId);
+    CCLOG("CMD: Undo Move Card %d", _record.cardId);
 }
\ No newline at end of file
@@ -1,18 +1,24 @@
 #pragma once
 #include "managers/ICommand.h"
+#include "managers/GameHistory.h"
 #include "models/GameModel.h"
 #include "views/GameView.h"
 
 /**
  * @class MoveCardCommand
- * @brief 
- * @responsibility ƴ(Playfield)ƶƶ(Discard)߼
+ * @brief 移牌命令
+ * @responsibility 处理将牌从桌面(Playfield)移动到底牌堆(Discard)的逻辑及撤销。
+ * @usage 由 UndoManager 的命令工厂按 MoveRecord 临时创建；数据变更委托给 GameHistory，本类只负责动画。
  */
 class MoveCardCommand : public ICommand {
 public:
-    MoveCardCommand(GameModel* model, GameView* view,
-        int cardId, int oldTopCardId,
-        cocos2d::Vec2 fromPos, cocos2d::Vec2 toPos);
+    /**
+     * @brief 构造函数
+     * @param model 数据模型
+     * @param view 视图引用
+     * @param record 操作记录 (type 为 MoveRecord::Move)
+     */
+    MoveCardCommand(GameModel* model, GameView* view, const MoveRecord& record);
 
     void execute() override;
     void undo() override;
@@ -21,11 +27,13 @@ private:
     GameModel* _model;
     GameView* _view;
 
-    int _cardId;        ///< ƶ ID
-    int _oldTopCardId;  ///< ƶǰĵƶѶ ID
+    CardModel* _card;       ///< 被移动的牌 (构造时解析的句柄)
+    CardView* _cardView;    ///< 被移动的牌的视图
+    CardView* _oldTopView;  ///< 移动前底牌堆顶的视图
 
-    cocos2d::Vec2 _fromPos; ///< 
-    cocos2d::Vec2 _toPos;   ///< յ
+    MoveRecord _record;     ///< 操作记录 (牌 ID、旧堆顶 ID、移动前的逻辑状态)
 
-    CardState _prevState;   ///< ƶǰ߼״̬
+    cocos2d::Vec2 _fromPos; ///< 起点坐标 (牌在桌面上的位置)
+
+    const cocos2d::Vec2 kDiscardPilePos = cocos2d::Vec2(540, 300);
 };
\ No newline at end of file
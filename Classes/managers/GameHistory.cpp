@@ -0,0 +1,251 @@
+#include "GameHistory.h"
+#include "services/GameRuleService.h"
+#include <algorithm>
+
+USING_NS_CC;
+
+namespace {
+    const uint64_t kMaxMoveIndex = 1ULL << 48;  ///< 存档中步数序号的上限，远超实际对局且相加不会溢出
+    const size_t kRecordBytes = 6;              ///< MoveRecord 的二进制长度
+    const size_t kMinSnapshotBytes = 35;        ///< 快照的最短二进制长度 (序号 + 空牌堆的局面)
+}
+
+GameHistory::GameHistory(int capacity, int snapshotInterval)
+    : _snapshotInterval(std::max(1, snapshotInterval))
+{
+    _records.resize(std::max(capacity, _snapshotInterval));
+}
+
+void GameHistory::reset(GameModel* model) {
+    clear();
+    _takeSnapshot(model);
+}
+
+void GameHistory::clear() {
+    _head = 0;
+    _size = 0;
+    _oldest = 0;
+    _current = 0;
+    _snapshots.clear();
+}
+
+void GameHistory::push(const MoveRecord& record, GameModel* model) {
+    // 1. 新操作使重做分支失效
+    if (canRedo()) {
+        _size = (int)(_current - _oldest);
+        while (!_snapshots.empty() && _snapshots.back().moveIndex > _current) {
+            _snapshots.pop_back();
+        }
+    }
+
+    // 2. 缓冲已满时整段丢弃最旧的记录
+    if (_size == (int)_records.size()) {
+        _dropOldest();
+    }
+
+    _records[(_head + _size) % _records.size()] = record;
+    _size++;
+    _current++;
+
+    // 3. 按间隔保存快照
+    if (_current % _snapshotInterval == 0) {
+        _takeSnapshot(model);
+    }
+}
+
+const MoveRecord* GameHistory::peekUndo() const {
+    return canUndo() ? &_recordAt(_current - 1) : nullptr;
+}
+
+const MoveRecord* GameHistory::peekRedo() const {
+    return canRedo() ? &_recordAt(_current) : nullptr;
+}
+
+void GameHistory::stepBack() {
+    if (canUndo()) _current--;
+}
+
+void GameHistory::stepForward() {
+    if (canRedo()) _current++;
+}
+
+bool GameHistory::undo(GameModel* model) {
+    const MoveRecord* record = peekUndo();
+    if (!record) return false;
+
+    revertMove(model, *record);
+    _current--;
+    return true;
+}
+
+bool GameHistory::redo(GameModel* model) {
+    const MoveRecord* record = peekRedo();
+    if (!record) return false;
+
+    applyMove(model, *record);
+    _current++;
+    return true;
+}
+
+bool GameHistory::jumpTo(GameModel* model, long long moveIndex) {
+    if (!model || moveIndex < _oldest || moveIndex > getLastMoveIndex()) return false;
+
+    // 1. 找到不晚于目标的最近快照
+    auto it = std::upper_bound(_snapshots.begin(), _snapshots.end(), moveIndex,
+        [](long long index, const Snapshot& snapshot) { return index < snapshot.moveIndex; });
+    if (it == _snapshots.begin()) {
+        CCLOG("GameHistory: No snapshot before move %lld", moveIndex);
+        return false;
+    }
+    const Snapshot& snapshot = *(it - 1);
+
+    // 2. 恢复快照并重建遮挡计数，再回放剩余记录
+    snapshot.state.applyTo(model);
+    GameRuleService::updateFaceUpStates(model);
+    for (long long i = snapshot.moveIndex; i < moveIndex; ++i) {
+        applyMove(model, _recordAt(i));
+    }
+
+    _current = moveIndex;
+    return true;
+}
+
+size_t GameHistory::getMemoryUsage() const {
+    return _records.size() * sizeof(MoveRecord) + _snapshots.size() * sizeof(Snapshot);
+}
+
+void GameHistory::serialize(ByteWriter& writer) const {
+    writer.writeVarint((uint64_t)_snapshotInterval);
+    writer.writeVarint((uint64_t)_oldest);
+    writer.writeVarint((uint64_t)(_current - _oldest));
+    writer.writeVarint((uint64_t)_size);
+    for (long long i = _oldest; i < getLastMoveIndex(); ++i) {
+        _recordAt(i).writeTo(writer);
+    }
+
+    writer.writeVarint((uint64_t)_snapshots.size());
+    for (const auto& snapshot : _snapshots) {
+        writer.writeVarint((uint64_t)snapshot.moveIndex);
+        snapshot.state.writeTo(writer);
+    }
+}
+
+bool GameHistory::deserialize(ByteReader& reader) {
+    clear();
+
+    // 先按无符号读出并校验范围，再转换为有符号值
+    uint64_t interval = reader.readVarint();
+    uint64_t oldest = reader.readVarint();
+    uint64_t offset = reader.readVarint();
+    uint64_t size = reader.readVarint();
+    if (!reader.isOk() || interval == 0 || interval > _records.size() || oldest > kMaxMoveIndex
+        || size > _records.size() || offset > size || size * kRecordBytes > reader.remaining()) {
+        return false;
+    }
+
+    for (uint64_t i = 0; i < size; ++i) {
+        _records[i].readFrom(reader);
+        if (!_records[i].isValid()) return false;
+    }
+
+    // 快照按序号递增，且必须落在历史范围内 (jumpTo 依赖有序)
+    uint64_t snapshotCount = reader.readVarint();
+    bool ok = reader.isOk() && snapshotCount <= reader.remaining() / kMinSnapshotBytes;
+    for (uint64_t i = 0; ok && i < snapshotCount; ++i) {
+        Snapshot snapshot;
+        uint64_t moveIndex = reader.readVarint();
+        ok = moveIndex >= oldest && moveIndex <= oldest + size
+            && (_snapshots.empty() || (long long)moveIndex >= _snapshots.back().moveIndex)
+            && snapshot.state.readFrom(reader);
+        snapshot.moveIndex = (long long)moveIndex;
+        if (ok) _snapshots.push_back(snapshot);
+    }
+    if (!ok || !reader.isOk()) {
+        clear();
+        return false;
+    }
+
+    _snapshotInterval = (int)interval;
+    _oldest = (long long)oldest;
+    _current = (long long)(oldest + offset);
+    _size = (int)size;
+    return true;
+}
+
+void GameHistory::applyMove(GameModel* model, const MoveRecord& record) {
+    auto card = model ? model->getCardById(record.cardId) : nullptr;
+    if (!card) return;
+
+    if (record.type == MoveRecord::Draw) {
+        // 抽牌：牌堆队首即为该牌
+        model->popNextDrawCard();
+        model->setCardState(card, CardState::Discard);
+        card->setFaceUp(true);
+        model->setTopCardId(record.cardId);
+        model->markCardChanged(record.cardId);
+        return;
+    }
+
+    model->setCardState(card, CardState::Discard);
+    model->setTopCardId(record.cardId);
+    model->markCardChanged(record.cardId);
+
+    // 只有被这张牌压住的牌可能翻面
+    if ((CardState)record.prevState == CardState::Playfield) {
+        GameRuleService::onCardLeftPlayfield(model, record.cardId);
+    }
+}
+
+void GameHistory::revertMove(GameModel* model, const MoveRecord& record) {
+    auto card = model ? model->getCardById(record.cardId) : nullptr;
+    if (!card) return;
+
+    if (record.type == MoveRecord::Draw) {
+        // 撤销抽牌：放回牌堆顶部并翻回背面
+        model->setCardState(card, CardState::Deck);
+        card->setFaceUp(false);
+        model->setTopCardId(record.prevTopId);
+        model->pushBackToDrawStackTop(record.cardId);
+        model->markCardChanged(record.cardId);
+        return;
+    }
+
+    model->setCardState(card, (CardState)record.prevState);
+    model->setTopCardId(record.prevTopId);
+    model->markCardChanged(record.cardId);
+
+    if ((CardState)record.prevState == CardState::Playfield) {
+        GameRuleService::onCardReturnedToPlayfield(model, record.cardId);
+    }
+}
+
+const MoveRecord& GameHistory::_recordAt(long long moveIndex) const {
+    return _records[(_head + (int)(moveIndex - _oldest)) % _records.size()];
+}
+
+void GameHistory::_dropOldest() {
+    // 丢弃到下一个快照为止，使最旧一步仍能从快照恢复；没有后续快照时只丢一步
+    long long target = _oldest + 1;
+    for (const auto& snapshot : _snapshots) {
+        if (snapshot.moveIndex > _oldest) {
+            target = std::min(snapshot.moveIndex, _current);
+            break;
+        }
+    }
+
+    int dropped = (int)(target - _oldest);
+    _head = (_head + dropped) % (int)_records.size();
+    _size -= dropped;
+    _oldest = target;
+
+    while (!_snapshots.empty() && _snapshots.front().moveIndex < _oldest) {
+        _snapshots.pop_front();
+    }
+}
+
+void GameHistory::_takeSnapshot(GameModel* model) {
+    Snapshot snapshot;
+    snapshot.moveIndex = _current;
+    if (!CompactGameState::fromModel(model, snapshot.state)) return;  // 超出 52 张时只保留增量记录
+    _snapshots.push_back(snapshot);
+}
@@ -0,0 +1,186 @@
+#pragma once
+#include "models/GameModel.h"
+#include "models/CompactGameState.h"
+#include "utils/BinaryStream.h"
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+/**
+ * @struct MoveRecord
+ * @brief 单步操作的增量记录 (6 字节)
+ * 只保存撤销/重做所需的最少信息，不引用任何 Model/View 对象。
+ */
+struct MoveRecord {
+    enum Type : uint8_t {
+        Move = 0,   ///< 桌面牌移入底牌堆
+        Draw = 1    ///< 从备用牌堆抽牌
+    };
+
+    uint8_t type;       ///< 操作类型
+    uint8_t prevState;  ///< 被操作牌移动前的 CardState (仅 Move 使用)
+    int16_t cardId;     ///< 被操作的卡牌 ID
+    int16_t prevTopId;  ///< 操作前的底牌堆顶 ID
+
+    static MoveRecord makeMove(int cardId, int prevTopId, CardState prevState) {
+        return { Move, (uint8_t)prevState, (int16_t)cardId, (int16_t)prevTopId };
+    }
+
+    static MoveRecord makeDraw(int cardId, int prevTopId) {
+        return { Draw, (uint8_t)CardState::Deck, (int16_t)cardId, (int16_t)prevTopId };
+    }
+
+    /**
+     * @brief 二进制读写 (固定 6 字节，存档与日志共用)
+     */
+    void writeTo(ByteWriter& writer) const {
+        writer.writeU8(type);
+        writer.writeU8(prevState);
+        writer.writeU16((uint16_t)cardId);
+        writer.writeU16((uint16_t)prevTopId);
+    }
+
+    void readFrom(ByteReader& reader) {
+        type = reader.readU8();
+        prevState = reader.readU8();
+        cardId = (int16_t)reader.readU16();
+        prevTopId = (int16_t)reader.readU16();
+    }
+
+    /**
+     * @brief 读入的字段是否在合法范围内 (不检查卡牌是否存在)
+     */
+    bool isValid() const {
+        return type <= Draw && prevState <= (uint8_t)CardState::Removed && cardId >= 0 && prevTopId >= -1;
+    }
+};
+
+/**
+ * @class GameHistory
+ * @brief 有界的操作历史 (撤销/重做/跳转)
+ * @responsibility 以环形缓冲保存最近 capacity 步的 MoveRecord，每 snapshotInterval 步保存一次
+ *                 CompactGameState 快照，支持逐步撤销/重做以及从最近快照出发的任意步跳转。
+ *                 超出容量时按快照间隔整段丢弃最旧的记录，保证最旧一步之前始终有快照可用。
+ * @usage 只操作 GameModel，不依赖 View，可在无界面工具中单独使用；
+ *        界面中由 UndoManager 持有，并负责播放对应的动画。
+ */
+class GameHistory {
+public:
+    static const int kDefaultCapacity = 4096;        ///< 默认最多保留的步数
+    static const int kDefaultSnapshotInterval = 32;  ///< 默认快照间隔 (步)
+
+    /**
+     * @param capacity 最多保留的记录数 (不小于 snapshotInterval)
+     * @param snapshotInterval 快照间隔，越小跳转越快、占用越多
+     */
+    explicit GameHistory(int capacity = kDefaultCapacity, int snapshotInterval = kDefaultSnapshotInterval);
+
+    /**
+     * @brief 清空历史，并以 model 的当前局面作为第 0 步的基准快照
+     */
+    void reset(GameModel* model);
+
+    /**
+     * @brief 清空历史 (不保存基准快照，之后无法跳转)
+     */
+    void clear();
+
+    /**
+     * @brief 登记一步已执行的操作
+     * 会丢弃当前位置之后的所有重做记录。
+     * @param record 操作记录
+     * @param model 执行该操作后的 Model (用于按间隔保存快照)
+     */
+    void push(const MoveRecord& record, GameModel* model);
+
+    bool canUndo() const { return _current > _oldest; }
+    bool canRedo() const { return _current < _oldest + _size; }
+
+    /**
+     * @brief 下一次撤销对应的记录 (canUndo 为 false 时返回 nullptr)
+     */
+    const MoveRecord* peekUndo() const;
+
+    /**
+     * @brief 下一次重做对应的记录 (canRedo 为 false 时返回 nullptr)
+     */
+    const MoveRecord* peekRedo() const;
+
+    /**
+     * @brief 只移动历史游标，不修改 Model (由调用方自行回放/播放动画)
+     */
+    void stepBack();
+    void stepForward();
+
+    /**
+     * @brief 撤销一步并回退 Model
+     * @return bool 是否有可撤销的记录
+     */
+    bool undo(GameModel* model);
+
+    /**
+     * @brief 重做一步并前进 Model
+     * @return bool 是否有可重做的记录
+     */
+    bool redo(GameModel* model);
+
+    /**
+     * @brief 跳转到第 moveIndex 步之后的局面
+     * 从不晚于目标的最近快照恢复，再回放至多 snapshotInterval 步记录。
+     * @param moveIndex 目标步数，范围 [getOldestMoveIndex(), getLastMoveIndex()]
+     * @return bool 目标超出保留范围时返回 false，Model 不变
+     */
+    bool jumpTo(GameModel* model, long long moveIndex);
+
+    long long getMoveIndex() const { return _current; }             ///< 当前已执行的步数
+    long long getOldestMoveIndex() const { return _oldest; }        ///< 最早可撤销到的步数
+    long long getLastMoveIndex() const { return _oldest + _size; }  ///< 可重做到的最大步数
+    int getRecordCount() const { return _size; }
+    int getSnapshotCount() const { return (int)_snapshots.size(); }
+
+    /**
+     * @brief 历史占用的字节数 (记录缓冲 + 快照)
+     */
+    size_t getMemoryUsage() const;
+
+    /**
+     * @brief 二进制序列化 (存档使用)：游标、全部保留记录与快照
+     */
+    void serialize(ByteWriter& writer) const;
+
+    /**
+     * @brief 从二进制恢复
+     * 记录数超过本实例容量、数量超出剩余字节、记录越界或快照序号不在历史范围内时返回 false
+     */
+    bool deserialize(ByteReader& reader);
+
+    // --- 单步规则：与 MoveCardCommand / DrawCardCommand 共享，保证界面与无界面行为一致 ---
+
+    /**
+     * @brief 在 Model 上正向执行一条记录
+     */
+    static void applyMove(GameModel* model, const MoveRecord& record);
+
+    /**
+     * @brief 在 Model 上撤销一条记录
+     */
+    static void revertMove(GameModel* model, const MoveRecord& record);
+
+private:
+    struct Snapshot {
+        long long moveIndex;        ///< 快照对应的步数
+        CompactGameState state;     ///< 该步执行后的完整局面
+    };
+
+    const MoveRecord& _recordAt(long long moveIndex) const;
+    void _dropOldest();
+    void _takeSnapshot(GameModel* model);
+
+    std::vector<MoveRecord> _records;   ///< 环形缓冲 (容量固定)
+    int _head = 0;                      ///< 最旧记录在缓冲中的下标
+    int _size = 0;                      ///< 有效记录数 (含可重做部分)
+    long long _oldest = 0;              ///< 最旧记录之前的步数
+    long long _current = 0;             ///< 当前步数
+    int _snapshotInterval;
+    std::deque<Snapshot> _snapshots;    ///< 按步数递增
+};
@@ -0,0 +1,119 @@
+#include "HintManager.h"
+#include <algorithm>
+
+namespace {
+    // _pack 的位布局 (低 32 位为局面序号)
+    const int kCardShift = 32;          ///< 16 位：cardId + 1
+    const int kDepthShift = 48;         ///< 8 位：完成的搜索深度
+    const uint64_t kValidBit = 1ULL << 56;
+    const uint64_t kDrawBit = 1ULL << 57;
+    const uint64_t kWinningBit = 1ULL << 58;
+}
+
+HintManager::HintManager(const HintOptions& options)
+    : _options(options), _worker(&HintManager::_workerLoop, this)
+{
+}
+
+HintManager::~HintManager() {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stop = true;
+        _cancel.store(true, std::memory_order_relaxed);
+    }
+    _wake.notify_one();
+    if (_worker.joinable()) _worker.join();
+}
+
+void HintManager::request(const CompactGameState& state, const BlockerMasks& blockers) {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        // 序号跳过 0 (0 表示无效)
+        uint32_t generation = _generation.load(std::memory_order_relaxed) + 1;
+        if (generation == 0) generation = 1;
+
+        _jobState = state;
+        _jobBlockers = blockers;
+        _jobGeneration = generation;
+        _hasJob = true;
+        _generation.store(generation, std::memory_order_release);
+        _cancel.store(true, std::memory_order_relaxed);
+    }
+    _wake.notify_one();
+}
+
+void HintManager::publish(const HintResult& result) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    uint32_t generation = _generation.load(std::memory_order_relaxed) + 1;
+    if (generation == 0) generation = 1;
+
+    // 工作线程发布前会核对序号，旧局面的结果不会覆盖这里
+    _hasJob = false;
+    _published.store(_pack(generation, result), std::memory_order_release);
+    _generation.store(generation, std::memory_order_release);
+    _cancel.store(true, std::memory_order_relaxed);
+}
+
+void HintManager::clear() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _hasJob = false;
+    _generation.store(0, std::memory_order_release);
+    _cancel.store(true, std::memory_order_relaxed);
+}
+
+bool HintManager::getHint(HintResult& out) const {
+    uint32_t generation = _generation.load(std::memory_order_acquire);
+    uint64_t packed = _published.load(std::memory_order_acquire);
+    if (generation == 0 || (uint32_t)packed != generation) return false;
+
+    _unpack(packed, out);
+    return true;
+}
+
+void HintManager::_workerLoop() {
+    while (true) {
+        CompactGameState state;
+        BlockerMasks blockers;
+        uint32_t generation;
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _wake.wait(lock, [this]() { return _stop || _hasJob; });
+            if (_stop) return;
+
+            // 取走任务的同时复位取消标记：之后再有提交会重新置位
+            state = _jobState;
+            blockers = _jobBlockers;
+            generation = _jobGeneration;
+            _hasJob = false;
+            _cancel.store(false, std::memory_order_relaxed);
+        }
+
+        HintResult result = HintSearch::search(state, blockers, _options, &_cancel);
+
+        // 被取消的搜索只返回了较浅的结果，局面也已过期，不发布
+        // (持锁核对序号，避免覆盖主线程 publish 的结果)
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_cancel.load(std::memory_order_relaxed)) continue;
+        if (_generation.load(std::memory_order_acquire) != generation) continue;
+        _published.store(_pack(generation, result), std::memory_order_release);
+    }
+}
+
+uint64_t HintManager::_pack(uint32_t generation, const HintResult& result) {
+    uint64_t packed = generation;
+    packed |= (uint64_t)(uint16_t)(result.cardId + 1) << kCardShift;
+    packed |= (uint64_t)(uint8_t)std::min(result.depth, 255) << kDepthShift;
+    if (result.valid) packed |= kValidBit;
+    if (result.isDraw) packed |= kDrawBit;
+    if (result.winning) packed |= kWinningBit;
+    return packed;
+}
+
+void HintManager::_unpack(uint64_t packed, HintResult& out) {
+    out = HintResult();
+    out.cardId = (int)(uint16_t)(packed >> kCardShift) - 1;
+    out.depth = (int)(uint8_t)(packed >> kDepthShift);
+    out.valid = (packed & kValidBit) != 0;
+    out.isDraw = (packed & kDrawBit) != 0;
+    out.winning = (packed & kWinningBit) != 0;
+}
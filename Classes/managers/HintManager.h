@@ -0,0 +1,78 @@
+#pragma once
+#include "services/HintSearch.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+/**
+ * @class HintManager
+ * @brief 后台提示引擎
+ * @responsibility 持有一个工作线程，在局面拷贝上运行限时的 HintSearch；
+ *                 新局面提交时取消进行中的搜索并重新开始，完成的结果打包进一个 64 位原子量发布。
+ * @usage GameController 每次操作生效后以 CompactGameState 拷贝调用 request；
+ *        界面通过 getHint 读取最近完成的结果，只做一次原子读取，从不等待工作线程。
+ */
+class HintManager {
+public:
+    explicit HintManager(const HintOptions& options = HintOptions());
+
+    /**
+     * @brief 取消搜索并等待工作线程退出 (搜索每 256 个节点检查一次取消，等待很短)
+     */
+    ~HintManager();
+
+    HintManager(const HintManager&) = delete;
+    HintManager& operator=(const HintManager&) = delete;
+
+    /**
+     * @brief 提交新局面 (主线程)
+     * 旧局面的搜索被取消，其结果不再发布。
+     * @param state 当前局面的拷贝 (翻面状态需已是最新)
+     * @param blockers 该关卡的静态遮挡表
+     */
+    void request(const CompactGameState& state, const BlockerMasks& blockers);
+
+    /**
+     * @brief 直接发布当前局面的提示且不再搜索 (主线程)
+     * 用于无法用 CompactGameState 表示的局面，提示由调用方按规则算出；进行中的搜索被取消。
+     * @param result 当前局面的提示
+     */
+    void publish(const HintResult& result);
+
+    /**
+     * @brief 作废当前提示且不再搜索
+     */
+    void clear();
+
+    /**
+     * @brief 读取当前局面的提示 (主线程，不阻塞)
+     * @param out 提示结果 (nodes 不随结果发布，恒为 0)
+     * @return bool 当前局面的搜索已完成时返回 true；仍在搜索或已作废时返回 false
+     */
+    bool getHint(HintResult& out) const;
+
+private:
+    void _workerLoop();
+
+    // 结果打包：低 32 位为局面序号，其余位为提示内容
+    static uint64_t _pack(uint32_t generation, const HintResult& result);
+    static void _unpack(uint64_t packed, HintResult& out);
+
+    HintOptions _options;
+
+    std::mutex _mutex;
+    std::condition_variable _wake;
+    bool _stop = false;                     ///< 通知工作线程退出
+    bool _hasJob = false;                   ///< 有待搜索的局面
+    CompactGameState _jobState;
+    BlockerMasks _jobBlockers = {};
+    uint32_t _jobGeneration = 0;
+
+    std::atomic<uint32_t> _generation{ 0 };     ///< 最新提交的局面序号 (0 表示无效)
+    std::atomic<bool> _cancel{ false };         ///< 取消进行中的搜索
+    std::atomic<uint64_t> _published{ 0 };      ///< 最近完成的结果 (_pack 格式)
+
+    std::thread _worker;                    ///< 最后初始化，保证线程启动时其余成员已构造
+};
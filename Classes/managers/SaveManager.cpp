@@ -0,0 +1,256 @@
+#include "SaveManager.h"
+#include "services/GameRuleService.h"
+#include "json/document.h"
+#include "json/stringbuffer.h"
+#include "json/writer.h"
+#include <cstdio>
+#include <cstring>
+
+USING_NS_CC;
+
+namespace {
+    const uint8_t kMagic[4] = { 'S', 'S', 'A', 'V' };
+
+    // 32 位 FNV-1a，用于发现截断或被改写的快照
+    uint32_t checksumOf(const uint8_t* data, size_t size) {
+        uint32_t h = 0x811C9DC5u;
+        for (size_t i = 0; i < size; ++i) {
+            h ^= data[i];
+            h *= 0x01000193u;
+        }
+        return h;
+    }
+
+    // 日志记录能否作用于当前局面：抽牌须正好抽到记录的牌，移动须是桌面上翻开的牌且堆顶一致
+    bool canApply(GameModel* model, const MoveRecord& record) {
+        auto card = model->getCardById(record.cardId);
+        if (!record.isValid() || !card) return false;
+
+        if (record.type == MoveRecord::Draw) {
+            int count = 0;
+            const int* next = model->peekNextDrawCards(1, count);
+            return count == 1 && next[0] == record.cardId && record.prevTopId == model->getTopCardId();
+        }
+        return card->getState() == CardState::Playfield && card->isFaceUp()
+            && record.prevState == (uint8_t)card->getState() && record.prevTopId == model->getTopCardId();
+    }
+
+    // 撤销只能撤回当前的堆顶牌
+    bool canRevert(GameModel* model, const MoveRecord* record) {
+        return record && record->cardId == model->getTopCardId() && model->getCardById(record->cardId);
+    }
+
+    void recordReplay(ReplayLog* replayLog, const MoveRecord& record) {
+        if (!replayLog) return;
+        if (record.type == MoveRecord::Draw) replayLog->recordDraw();
+        else replayLog->recordClick(record.cardId);
+    }
+}
+
+SaveManager::SaveManager(const std::string& filename, int compactThreshold)
+    : _filename(filename.empty() ? getDefaultSavePath() : filename),
+    _compactThreshold(compactThreshold > 0 ? compactThreshold : kDefaultCompactThreshold)
+{
+}
+
+std::string SaveManager::getDefaultSavePath() {
+    return FileUtils::getInstance()->getWritablePath() + "savegame.bin";
+}
+
+bool SaveManager::writeSnapshot() {
+    if (!_context.model || !_context.history) return false;
+
+    // 1. 快照正文
+    std::vector<uint8_t> snapshot;
+    ByteWriter body(snapshot);
+    body.writeVarint((uint64_t)_context.levelId);
+    body.writeU8(_context.endless ? 1 : 0);
+    _context.model->serializeToBinary(body);
+    _context.history->serialize(body);
+
+    std::vector<uint8_t> replay;
+    if (_context.replayLog) replay = _context.replayLog->serialize();
+    body.writeVarint((uint64_t)replay.size());
+    body.writeBytes(replay.data(), replay.size());
+
+    // 2. 文件头
+    std::vector<uint8_t> bytes;
+    bytes.reserve(snapshot.size() + 16);
+    ByteWriter writer(bytes);
+    writer.writeBytes(kMagic, sizeof(kMagic));
+    writer.writeU8(kVersion);
+    writer.writeVarint((uint64_t)snapshot.size());
+    writer.writeU32(checksumOf(snapshot.data(), snapshot.size()));
+    writer.writeBytes(snapshot.data(), snapshot.size());
+
+    // 3. 先写临时文件再替换，避免写到一半被杀进程时丢失旧存档
+    Data data;
+    data.copy(bytes.data(), (ssize_t)bytes.size());
+    std::string tempFile = _filename + ".tmp";
+    auto fileUtils = FileUtils::getInstance();
+    if (!fileUtils->writeDataToFile(data, tempFile)) {
+        CCLOG("Error: Failed to write save: %s", tempFile.c_str());
+        return false;
+    }
+    if (fileUtils->isFileExist(_filename)) fileUtils->removeFile(_filename);
+    if (!fileUtils->renameFile(tempFile, _filename)) {
+        CCLOG("Error: Failed to replace save: %s", _filename.c_str());
+        return false;
+    }
+
+    _journalEntries = 0;
+    return true;
+}
+
+void SaveManager::appendExecute(const MoveRecord& record) {
+    std::vector<uint8_t> entry;
+    ByteWriter writer(entry);
+    writer.writeU8(kJournalExecute);
+    record.writeTo(writer);
+    _append(entry.data(), entry.size());
+}
+
+void SaveManager::appendUndo() {
+    uint8_t entry = kJournalUndo;
+    _append(&entry, 1);
+}
+
+void SaveManager::appendRedo() {
+    uint8_t entry = kJournalRedo;
+    _append(&entry, 1);
+}
+
+void SaveManager::_append(const uint8_t* data, size_t size) {
+    if (!_context.model) return;
+
+    // 日志太长时改为重写快照，恢复时回放的条数有上限
+    if (_journalEntries + 1 >= _compactThreshold) {
+        writeSnapshot();
+        return;
+    }
+
+    FILE* file = fopen(FileUtils::getInstance()->getSuitableFOpen(_filename).c_str(), "ab");
+    if (!file) {
+        CCLOG("Error: Failed to append save journal: %s", _filename.c_str());
+        return;
+    }
+    fwrite(data, 1, size, file);
+    fclose(file);
+    _journalEntries++;
+}
+
+bool SaveManager::load(SaveContext& context) {
+    if (!context.model || !context.history) return false;
+
+    Data data = FileUtils::getInstance()->getDataFromFile(_filename);
+    if (data.isNull()) return false;
+
+    // 1. 文件头与快照；无法使用的存档直接删除，避免每次启动都尝试恢复
+    ByteReader reader(data.getBytes(), (size_t)data.getSize());
+    if (!_loadSnapshot(reader, context)) {
+        CCLOG("SaveManager: Save is corrupted or outdated, discarded.");
+        remove();
+        return false;
+    }
+
+    // 2. 回放快照之后的日志；末尾残缺 (写入时被中断) 或与局面不符时丢弃其后的日志并立即重写快照
+    bool intact = _replayJournal(reader, context);
+    bind(context);
+    if (!intact) writeSnapshot();
+
+    CCLOG("SaveManager: Resumed level %d at move %lld (%d journal entries)",
+        context.levelId, context.history->getMoveIndex(), _journalEntries);
+    return true;
+}
+
+bool SaveManager::_loadSnapshot(ByteReader& reader, SaveContext& context) {
+    // 1. 文件头
+    const uint8_t* magic = reader.readBytes(sizeof(kMagic));
+    if (!magic || memcmp(magic, kMagic, sizeof(kMagic)) != 0) return false;
+    if (reader.readU8() != kVersion) {
+        CCLOG("SaveManager: Unsupported save version, ignored.");
+        return false;
+    }
+    uint64_t snapshotSize = reader.readVarint();
+    uint32_t checksum = reader.readU32();
+    if (!reader.isOk() || snapshotSize > reader.remaining()) return false;
+    const uint8_t* snapshot = reader.readBytes((size_t)snapshotSize);
+    if (!snapshot || checksumOf(snapshot, (size_t)snapshotSize) != checksum) return false;
+
+    // 2. 快照：Model 恢复后先重建遮挡计数，日志回放依赖增量翻面
+    ByteReader body(snapshot, (size_t)snapshotSize);
+    context.levelId = (int)body.readVarint();
+    context.endless = body.readU8() != 0;
+    if (!context.model->deserializeFromBinary(body)) return false;
+    GameRuleService::updateFaceUpStates(context.model);
+    if (!context.history->deserialize(body)) return false;
+
+    uint64_t replaySize = body.readVarint();
+    if (!body.isOk() || replaySize > body.remaining()) return false;
+    const uint8_t* replay = body.readBytes((size_t)replaySize);
+    if (context.replayLog && !context.replayLog->deserialize(replay, (size_t)replaySize)) {
+        context.replayLog->reset(context.levelId, 0);
+    }
+    return true;
+}
+
+bool SaveManager::_replayJournal(ByteReader& reader, SaveContext& context) {
+    _journalEntries = 0;
+    while (!reader.atEnd()) {
+        uint8_t op = reader.readU8();
+        if (op == kJournalExecute) {
+            MoveRecord record;
+            record.readFrom(reader);
+            if (!reader.isOk() || !canApply(context.model, record)) return false;
+
+            GameHistory::applyMove(context.model, record);
+            context.history->push(record, context.model);
+            recordReplay(context.replayLog, record);
+        }
+        else if (op == kJournalUndo) {
+            if (!canRevert(context.model, context.history->peekUndo())) return false;
+            if (!context.history->undo(context.model)) return false;
+            if (context.replayLog) context.replayLog->recordUndo();
+        }
+        else if (op == kJournalRedo) {
+            const MoveRecord* record = context.history->peekRedo();
+            if (!record || !canApply(context.model, *record)) return false;
+            if (!context.history->redo(context.model)) return false;
+            if (context.replayLog) context.replayLog->recordRedo();
+        }
+        else {
+            return false;
+        }
+        _journalEntries++;
+    }
+    return true;
+}
+
+bool SaveManager::hasSave() const {
+    return FileUtils::getInstance()->isFileExist(_filename);
+}
+
+void SaveManager::remove() {
+    if (hasSave()) FileUtils::getInstance()->removeFile(_filename);
+    _journalEntries = 0;
+}
+
+bool SaveManager::exportJson(const std::string& filename) const {
+    if (!_context.model || !_context.history) return false;
+
+    // 在 Model 的 JSON 基础上补充关卡与历史游标
+    rapidjson::Document doc;
+    doc.Parse(_context.model->serializeToJson().c_str());
+    if (doc.HasParseError()) return false;
+
+    auto& allocator = doc.GetAllocator();
+    doc.AddMember("levelId", _context.levelId, allocator);
+    doc.AddMember("endless", _context.endless, allocator);
+    doc.AddMember("moveIndex", (int64_t)_context.history->getMoveIndex(), allocator);
+    doc.AddMember("historyRecords", _context.history->getRecordCount(), allocator);
+
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+    doc.Accept(writer);
+    return FileUtils::getInstance()->writeStringToFile(buffer.GetString(), filename);
+}
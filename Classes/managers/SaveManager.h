@@ -0,0 +1,107 @@
+#pragma once
+#include "GameHistory.h"
+#include "models/GameModel.h"
+#include "models/ReplayLog.h"
+#include <cstdint>
+#include <string>
+
+class ByteReader;
+
+/**
+ * @struct SaveContext
+ * @brief 存档涉及的对局数据 (均不持有所有权)
+ */
+struct SaveContext {
+    int levelId = 0;                    ///< 关卡 ID
+    bool endless = false;               ///< 是否为无尽模式 (桌面清空后继续发新牌)
+    GameModel* model = nullptr;         ///< 数据模型
+    GameHistory* history = nullptr;     ///< 撤销/重做历史
+    ReplayLog* replayLog = nullptr;     ///< 操作日志 (可为空)
+};
+
+/**
+ * @class SaveManager
+ * @brief 存档管理器 (快照 + 增量日志)
+ * @responsibility 将完整对局 (卡牌状态/坐标/层级、牌堆顺序、底牌、遮挡图、撤销历史、操作日志)
+ *                 写成带版本号的二进制快照；之后每步只向文件末尾追加几个字节的日志，
+ *                 日志条数达到阈值时重写快照。恢复时一次读入文件，反序列化快照再回放日志，
+ *                 不需要重新运行 GameModelGenerator。
+ * @usage 由 GameController 持有：开局 bind + writeSnapshot，每步操作后 append*，结束时 remove。
+ *
+ * 文件格式 (小端序)：
+ *   "SSAV" | version:u8 | snapshotSize:varint | checksum:u32 | snapshot | journal...
+ *   checksum 为快照正文的 32 位 FNV-1a；日志条目回放前逐条对照当前局面校验。
+ *   快照正文：levelId:varint | endless:u8 | GameModel | GameHistory | replaySize:varint | replay
+ *   日志条目：0x01 + MoveRecord(6 字节) 执行；0x02 撤销；0x03 重做。
+ */
+class SaveManager {
+public:
+    static const uint8_t kVersion = 3;
+    static const int kDefaultCompactThreshold = 64;     ///< 日志条数达到该值时重写快照
+
+    /**
+     * @param filename 存档完整路径，为空时使用 getDefaultSavePath()
+     * @param compactThreshold 重写快照的日志条数阈值
+     */
+    explicit SaveManager(const std::string& filename = "", int compactThreshold = kDefaultCompactThreshold);
+
+    /**
+     * @brief 默认存档路径 (可写目录下的 savegame.bin)
+     */
+    static std::string getDefaultSavePath();
+
+    /**
+     * @brief 绑定要保存的对局数据
+     */
+    void bind(const SaveContext& context) { _context = context; }
+
+    /**
+     * @brief 重写完整快照并清空日志 (先写临时文件再改名，写入中断不会损坏旧存档)
+     * @return bool 写入是否成功
+     */
+    bool writeSnapshot();
+
+    /**
+     * @brief 追加一步执行/撤销/重做日志，达到阈值时自动重写快照
+     */
+    void appendExecute(const MoveRecord& record);
+    void appendUndo();
+    void appendRedo();
+
+    /**
+     * @brief 读取存档并恢复对局
+     * @param context 需提供 model 与 history (replayLog 可选)，成功后填入 levelId / endless 并自动 bind
+     * @return bool 无存档、版本不符或数据损坏时返回 false (后两种情况会删除存档，下次启动直接开新局)
+     */
+    bool load(SaveContext& context);
+
+    bool hasSave() const;
+
+    /**
+     * @brief 删除存档 (对局结束时调用)
+     */
+    void remove();
+
+    /**
+     * @brief 导出当前对局的 JSON (仅用于调试查看)
+     */
+    bool exportJson(const std::string& filename) const;
+
+    int getJournalEntries() const { return _journalEntries; }
+
+private:
+    enum JournalOp : uint8_t {
+        kJournalExecute = 0x01,
+        kJournalUndo = 0x02,
+        kJournalRedo = 0x03
+    };
+
+    void _append(const uint8_t* data, size_t size);
+    bool _loadSnapshot(ByteReader& reader, SaveContext& context);
+    bool _replayJournal(ByteReader& reader, SaveContext& context);
+
+    std::string _filename;
+    int _compactThreshold;
+    SaveContext _context;
+    int _journalEntries = 0;    ///< 当前快照之后的日志条数
+};
@@ -1,45 +1,75 @@
 #include "UndoManager.h"
 #include "cocos2d.h"
 
-UndoManager::UndoManager() {}
+UndoManager::UndoManager(int capacity, int snapshotInterval)
+    : _history(capacity, snapshotInterval)
+{
+}
 
 UndoManager::~UndoManager() {
     clear();
 }
 
-void UndoManager::addCommand(std::unique_ptr<ICommand> cmd) {
-    if (!cmd) return;
+void UndoManager::reset(GameModel* model) {
+    _model = model;
+    _history.reset(model);
+}
+
+void UndoManager::execute(const MoveRecord& record) {
+    if (!_model) return;
 
-    // 1. ִҵ߼
-    cmd->execute();
+    // 1. 先执行业务逻辑 (有视图时由命令同时播放动画)
+    auto cmd = _createCommand(record);
+    if (cmd) cmd->execute();
+    else GameHistory::applyMove(_model, record);
 
-    // 2. ѹʷջ (ʹ std::move תȨ)
-    _commandStack.push_back(std::move(cmd));
+    // 2. 再登记到历史 (只保存几个字节的记录)
+    _history.push(record, _model);
 
-    CCLOG("UndoManager: Command added. Stack size: %zd", _commandStack.size());
+    CCLOG("UndoManager: Move recorded. History: %d records, %d snapshots",
+        _history.getRecordCount(), _history.getSnapshotCount());
 }
 
-void UndoManager::undo() {
-    if (_commandStack.empty()) {
+bool UndoManager::undo() {
+    const MoveRecord* record = _history.peekUndo();
+    if (!_model || !record) {
         CCLOG("UndoManager: Nothing to undo.");
-        return;
+        return false;
     }
 
-    // 1. ȡջ
-    auto& cmd = _commandStack.back();
+    auto cmd = _createCommand(*record);
+    if (cmd) cmd->undo();
+    else GameHistory::revertMove(_model, *record);
+    _history.stepBack();
+
+    CCLOG("UndoManager: Undo executed. Move index: %lld", _history.getMoveIndex());
+    return true;
+}
 
-    // 2. ִг߼
-    if (cmd) {
-        cmd->undo();
+bool UndoManager::redo() {
+    const MoveRecord* record = _history.peekRedo();
+    if (!_model || !record) {
+        CCLOG("UndoManager: Nothing to redo.");
+        return false;
     }
 
-    // 3. Ƴ¼ (ʱ unique_ptr ջԶ Command )
-    _commandStack.pop_back();
+    auto cmd = _createCommand(*record);
+    if (cmd) cmd->execute();
+    else GameHistory::applyMove(_model, *record);
+    _history.stepForward();
 
-    CCLOG("UndoManager: Undo executed. Stack size: %zd", _commandStack.size());
+    CCLOG("UndoManager: Redo executed. Move index: %lld", _history.getMoveIndex());
+    return true;
+}
+
+bool UndoManager::jumpTo(long long moveIndex) {
+    return _history.jumpTo(_model, moveIndex);
 }
 
 void UndoManager::clear() {
-    // vector::clear  unique_ptr delete  Command 
-    _commandStack.clear();
-}
\ No newline at end of file
+    _history.clear();
+}
+
+std::unique_ptr<ICommand> UndoManager::_createCommand(const MoveRecord& record) {
+    return _commandFactory ? _commandFactory(record) : nullptr;
+}
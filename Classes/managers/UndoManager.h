@@ -1,42 +1,89 @@
 #pragma once
 #include "ICommand.h"
-#include <vector>
-#include <memory> 
+#include "GameHistory.h"
+#include <functional>
+#include <memory>
 
 /**
  * @class UndoManager
- * @brief /˹
- * @responsibility άʷջִСջԼ
- * @usage  GameController гԱʹõģʽ
+ * @brief 撤销/重做管理器
+ * @responsibility 以 GameHistory 保存紧凑的操作记录 (有界环形缓冲 + 定期快照)，
+ *                 在执行、撤销、重做时按记录临时创建命令对象来驱动 Model 与 View，命令用完即销毁。
+ * @usage 由 GameController 持有成员变量，不使用单例模式。
+ *        未设置命令工厂时只修改 Model，可在无界面环境中使用。
  */
 class UndoManager {
 public:
-    UndoManager();
+    /**
+     * @brief 命令工厂：根据操作记录创建带视图表现的命令
+     */
+    typedef std::function<std::unique_ptr<ICommand>(const MoveRecord&)> CommandFactory;
+
+    /**
+     * @param capacity 最多保留的步数
+     * @param snapshotInterval 快照间隔 (步)
+     */
+    explicit UndoManager(int capacity = GameHistory::kDefaultCapacity,
+        int snapshotInterval = GameHistory::kDefaultSnapshotInterval);
     ~UndoManager();
 
     /**
-     * @brief ִв¼
-     * @param cmd ָ (ȨתƸ UndoManager)
-     * @note ô˷ʱԶ cmd->execute()
+     * @brief 设置命令工厂 (为空时只修改 Model)
      */
-    void addCommand(std::unique_ptr<ICommand> cmd);
+    void setCommandFactory(const CommandFactory& factory) { _commandFactory = factory; }
 
     /**
-     * @brief ִл˲
-     * ȡջִ undo()ȻƳ
+     * @brief 绑定 Model 并以其当前局面作为历史起点
+     * 通常在开始游戏、生成初始牌局后调用。Model 的生命周期由调用方管理。
      */
-    void undo();
+    void reset(GameModel* model);
 
     /**
-     * @brief ʷ¼
-     * ͨ¿ʼϷлؿʱá
+     * @brief 只绑定 Model，保留现有历史 (从存档恢复后调用)
      */
-    void clear();
+    void bindModel(GameModel* model) { _model = model; }
+
+    /**
+     * @brief 执行并记录一步操作
+     * @param record 操作记录
+     * @note 会丢弃当前所有可重做的记录。
+     */
+    void execute(const MoveRecord& record);
+
+    /**
+     * @brief 执行回退操作
+     * @return bool 是否有可撤销的操作
+     */
+    bool undo();
 
-private:
     /**
-     * @brief ʷջ
-     * ʹ vector ģջṹ洢ָ̬룬Զڡ
+     * @brief 重做最近一次撤销的操作
+     * @return bool 是否有可重做的操作
      */
-    std::vector<std::unique_ptr<ICommand>> _commandStack;
-};
\ No newline at end of file
+    bool redo();
+
+    /**
+     * @brief 直接跳转到第 moveIndex 步 (只修改 Model，不播放动画)
+     * @return bool 目标超出保留范围时返回 false
+     */
+    bool jumpTo(long long moveIndex);
+
+    bool canUndo() const { return _history.canUndo(); }
+    bool canRedo() const { return _history.canRedo(); }
+
+    /**
+     * @brief 清空历史记录
+     * 通常在重新开始游戏或切换关卡时调用。
+     */
+    void clear();
+
+    const GameHistory& getHistory() const { return _history; }
+    GameHistory& getHistory() { return _history; }
+
+private:
+    std::unique_ptr<ICommand> _createCommand(const MoveRecord& record);
+
+    GameModel* _model = nullptr;        ///< 当前绑定的 Model (不持有引用)
+    GameHistory _history;               ///< 紧凑操作历史
+    CommandFactory _commandFactory;     ///< 带视图表现的命令工厂
+};
@@ -1,4 +1,6 @@
 #include "CardModel.h"
+#include "utils/BinaryStream.h"
+#include <cstring>
 
 USING_NS_CC;
 
@@ -16,8 +18,8 @@ bool CardModel::init(int id, CardFace face, CardSuit suit) {
     _id = id;
     _face = face;
     _suit = suit;
-    _isFaceUp = false;          // Ĭϱ
-    _state = CardState::Deck;   // Ĭƶ
+    _isFaceUp = false;          // 默认背面
+    _state = CardState::Deck;   // 默认在牌堆
     _zOrder = 0;
 
     return true;
@@ -29,18 +31,92 @@ void CardModel::toJson(rapidjson::Value& outValue, rapidjson::Document::Allocato
     outValue.AddMember("face", (int)_face, allocator);
     outValue.AddMember("suit", (int)_suit, allocator);
     outValue.AddMember("faceUp", _isFaceUp, allocator);
-    // 飺ҪָϷstate  position ҲӦñл
+    outValue.AddMember("state", (int)_state, allocator);
+    outValue.AddMember("x", _position.x, allocator);
+    outValue.AddMember("y", _position.y, allocator);
+    outValue.AddMember("z", _zOrder, allocator);
 }
 
 bool CardModel::fromJson(const rapidjson::Value& jsonValue) {
-    if (!jsonValue.HasMember("id") || !jsonValue.HasMember("face")) return false;
+    if (!jsonValue.IsObject() || !jsonValue.HasMember("id") || !jsonValue.HasMember("face")
+        || !jsonValue.HasMember("suit")) return false;
 
-    _id = jsonValue["id"].GetInt();
-    _face = (CardFace)jsonValue["face"].GetInt();
-    _suit = (CardSuit)jsonValue["suit"].GetInt();
+    // 与 fromBinary 相同的范围校验
+    const auto& id = jsonValue["id"];
+    const auto& face = jsonValue["face"];
+    const auto& suit = jsonValue["suit"];
+    if (!id.IsInt() || id.GetInt() < 0 || id.GetInt() >= kMaxDecks * kCardsPerDeck) return false;
+    if (!face.IsInt() || face.GetInt() < (int)CardFace::Ace || face.GetInt() > (int)CardFace::King) return false;
+    if (!suit.IsInt() || suit.GetInt() < (int)CardSuit::Clubs || suit.GetInt() > (int)CardSuit::Spades) return false;
+
+    _id = id.GetInt();
+    _face = (CardFace)face.GetInt();
+    _suit = (CardSuit)suit.GetInt();
 
     if (jsonValue.HasMember("faceUp")) {
+        if (!jsonValue["faceUp"].IsBool()) return false;
         _isFaceUp = jsonValue["faceUp"].GetBool();
     }
+    if (jsonValue.HasMember("state")) {
+        const auto& state = jsonValue["state"];
+        if (!state.IsInt() || state.GetInt() < (int)CardState::Deck || state.GetInt() > (int)CardState::Removed) return false;
+        _state = (CardState)state.GetInt();
+    }
+    if (jsonValue.HasMember("x") && jsonValue.HasMember("y")) {
+        if (!jsonValue["x"].IsNumber() || !jsonValue["y"].IsNumber()) return false;
+        _position = Vec2(jsonValue["x"].GetFloat(), jsonValue["y"].GetFloat());
+    }
+    if (jsonValue.HasMember("z")) {
+        if (!jsonValue["z"].IsInt()) return false;
+        _zOrder = jsonValue["z"].GetInt();
+    }
+    return true;
+}
+
+namespace {
+    // 坐标按 IEEE754 位模式写出，保证读回的值完全一致
+    uint32_t floatBits(float value) {
+        uint32_t bits;
+        memcpy(&bits, &value, sizeof(bits));
+        return bits;
+    }
+
+    float bitsToFloat(uint32_t bits) {
+        float value;
+        memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+}
+
+void CardModel::toBinary(ByteWriter& writer) const {
+    writer.writeVarint((uint64_t)_id);
+    writer.writeU8((uint8_t)_face);
+    writer.writeU8((uint8_t)_suit);
+    writer.writeU8((uint8_t)_state);
+    writer.writeU8(_isFaceUp ? 1 : 0);
+    writer.writeVarint((uint64_t)(uint32_t)_zOrder);
+    writer.writeU32(floatBits(_position.x));
+    writer.writeU32(floatBits(_position.y));
+}
+
+bool CardModel::fromBinary(ByteReader& reader) {
+    // 先按原始值读出并校验范围，损坏的存档不能产生越界 ID 或非法枚举
+    uint64_t id = reader.readVarint();
+    uint8_t face = reader.readU8();
+    uint8_t suit = reader.readU8();
+    uint8_t state = reader.readU8();
+    _isFaceUp = reader.readU8() != 0;
+    _zOrder = (int)(uint32_t)reader.readVarint();
+    float x = bitsToFloat(reader.readU32());
+    float y = bitsToFloat(reader.readU32());
+    if (!reader.isOk() || id >= (uint64_t)kMaxDecks * kCardsPerDeck) return false;
+    if (face < (uint8_t)CardFace::Ace || face > (uint8_t)CardFace::King) return false;
+    if (suit > (uint8_t)CardSuit::Spades || state > (uint8_t)CardState::Removed) return false;
+
+    _id = (int)id;
+    _face = (CardFace)face;
+    _suit = (CardSuit)suit;
+    _state = (CardState)state;
+    _position = Vec2(x, y);
     return true;
 }
\ No newline at end of file
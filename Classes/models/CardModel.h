@@ -3,65 +3,92 @@
 #include "GameConstants.h"
 #include "json/document.h" 
 
+class ByteWriter;
+class ByteReader;
+
 /**
  * @class CardModel
- * @brief ſƵģ
- * @responsibility άƵĻԣɫ״̬桢λãԼл߼
- * @usage  GameModel ͳһ͹View ֻȡݲ޸ݡ
+ * @brief 单张卡牌的数据模型
+ * @responsibility 维护卡牌的基础属性（花色、点数）、状态（正反面、位置）以及序列化逻辑。
+ * @usage 由 GameModel 统一创建和管理，View 层只读取数据不修改数据。
  */
 class CardModel : public cocos2d::Ref {
 public:
     /**
-     * @brief ̬
-     * @param id Ψһ ID
-     * @param face 
-     * @param suit ɫ
-     * @return CardModel* Զʵ
+     * @brief 静态工厂方法创建卡牌
+     * @param id 唯一 ID
+     * @param face 点数
+     * @param suit 花色
+     * @return CardModel* 自动管理的实例对象
      */
     static CardModel* create(int id, CardFace face, CardSuit suit);
 
+    /**
+     * @brief 按 (牌副, 花色, 点数) 计算卡牌 ID，O(1)
+     * @param deck 牌副序号 (0 起)
+     * @param suit 花色 0-3
+     * @param face 点数 1-13
+     * @return int 卡牌 ID，参数越界时返回 -1
+     */
+    static int makeId(int deck, int suit, int face) {
+        if (deck < 0 || deck >= kMaxDecks || suit < 0 || suit > 3 || face < 1 || face > 13) return -1;
+        return deck * kCardsPerDeck + suit * 13 + (face - 1);
+    }
+
     // Getters
     int getId() const { return _id; }
+    int getDeck() const { return _id / kCardsPerDeck; }   ///< 所属牌副 (由 ID 推出，不单独存储)
     CardFace getFace() const { return _face; }
     CardSuit getSuit() const { return _suit; }
 
     /**
-     * @brief ȡǷ泯
+     * @brief 获取是否正面朝上
      */
     bool isFaceUp() const { return _isFaceUp; }
 
     /**
-     * @brief ÿƷ״̬
-     * @param isFaceUp trueΪ棬falseΪ
+     * @brief 设置卡牌翻面状态
+     * @param isFaceUp true为正面，false为背面
      */
     void setFaceUp(bool isFaceUp) { _isFaceUp = isFaceUp; }
 
     /**
-     * @brief ȡƵǰ߼״̬ƶѡȣ
+     * @brief 获取卡牌当前逻辑状态（在牌堆、在牌桌等）
      */
     CardState getState() const { return _state; }
 
     /**
-     * @brief ޸Ŀ߼״̬
-     * @param state ״̬
+     * @brief 修改卡牌逻辑状态
+     * @param state 新状态
      */
     void setState(CardState state) { _state = state; }
 
     /**
-     * @brief лǰ״̬д JSON 
-     * @param outValue  RapidJSON Value
-     * @param allocator RapidJSON 
+     * @brief 序列化：将当前状态写入 JSON 对象
+     * @param outValue 输出的 RapidJSON Value
+     * @param allocator RapidJSON 分配器
      */
     void toJson(rapidjson::Value& outValue, rapidjson::Document::AllocatorType& allocator) const;
 
     /**
-     * @brief л JSON ָ
-     * @param jsonValue  JSON 
-     * @return bool Ƿɹ
+     * @brief 反序列化：从 JSON 恢复数据
+     * @param jsonValue 输入的 JSON 数据
+     * @return bool 是否成功
      */
     bool fromJson(const rapidjson::Value& jsonValue);
 
-    // ߼λ (Ⱦ꣬߼ָλ)
+    /**
+     * @brief 二进制序列化：写入全部字段 (存档使用)
+     */
+    void toBinary(ByteWriter& writer) const;
+
+    /**
+     * @brief 二进制反序列化
+     * @return bool 数据不完整，或 ID、点数、花色、状态越界时返回 false
+     */
+    bool fromBinary(ByteReader& reader);
+
+    // 逻辑位置数据 (非渲染坐标，用于逻辑计算或恢复位置)
     void setPosition(const cocos2d::Vec2& pos) { _position = pos; }
     const cocos2d::Vec2& getPosition() const { return _position; }
 
@@ -70,15 +97,15 @@ public:
 
 private:
     /**
-     * @brief ڲʼ
+     * @brief 内部初始化函数
      */
     bool init(int id, CardFace face, CardSuit suit);
 
-    int _id;                 ///< Ψһʶ
-    CardFace _face;          ///< 
-    CardSuit _suit;          ///< ɫ
-    bool _isFaceUp;          ///< ״̬
-    CardState _state;        ///< ǰ߼
-    cocos2d::Vec2 _position; ///< ߼껺
-    int _zOrder;             ///< ߼㼶
+    int _id;                 ///< 唯一标识符
+    CardFace _face;          ///< 点数
+    CardSuit _suit;          ///< 花色
+    bool _isFaceUp;          ///< 正反面状态
+    CardState _state;        ///< 当前逻辑区域
+    cocos2d::Vec2 _position; ///< 逻辑坐标缓存
+    int _zOrder;             ///< 逻辑层级
 };
\ No newline at end of file
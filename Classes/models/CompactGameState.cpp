@@ -0,0 +1,145 @@
+#include "CompactGameState.h"
+#include "GameModel.h"
+#include "utils/BinaryStream.h"
+
+USING_NS_CC;
+
+bool CompactGameState::fromModel(GameModel* model, CompactGameState& out) {
+    out = CompactGameState();
+    if (!model) return false;
+
+    for (auto card : model->getAllCards()) {
+        int id = card->getId();
+        if (id < 0 || id >= kMaxCards) return false;
+
+        switch (card->getState()) {
+        case CardState::Playfield: out.playfieldMask |= bit(id); break;
+        case CardState::Deck:      out.deckMask |= bit(id); break;
+        case CardState::Discard:   out.discardMask |= bit(id); break;
+        default: break; // Removed：不进入任何掩码
+        }
+        if (card->isFaceUp()) out.faceUpMask |= bit(id);
+    }
+
+    const DrawStack& drawStack = model->getDrawStack();
+    if (drawStack.size() > kMaxCards) return false;
+    for (int i = 0; i < drawStack.size(); ++i) {
+        out.drawOrder[i] = (int8_t)drawStack.at(i);
+    }
+    out.drawCount = (uint8_t)drawStack.size();
+    out.topCardId = (int8_t)model->getTopCardId();
+    return true;
+}
+
+void CompactGameState::applyTo(GameModel* model) const {
+    if (!model) return;
+
+    for (auto card : model->getAllCards()) {
+        int id = card->getId();
+        if (id < 0 || id >= kMaxCards) continue;
+
+        uint64_t b = bit(id);
+        CardState state = CardState::Removed;
+        if (playfieldMask & b) state = CardState::Playfield;
+        else if (deckMask & b) state = CardState::Deck;
+        else if (discardMask & b) state = CardState::Discard;
+        bool faceUp = (faceUpMask & b) != 0;
+
+        // 只把实际变化的牌计入变更集
+        if (card->getState() == state && card->isFaceUp() == faceUp) continue;
+        model->setCardState(card, state);
+        card->setFaceUp(faceUp);
+        model->markCardChanged(id);
+    }
+
+    model->clearDrawStack();
+    for (int i = 0; i < drawCount; ++i) {
+        model->pushToDrawStack(drawOrder[drawHead + i]);
+    }
+    model->setTopCardId(topCardId);
+}
+
+void CompactGameState::moveToDiscard(int cardId) {
+    uint64_t b = bit(cardId);
+    playfieldMask &= ~b;
+    discardMask |= b;
+    topCardId = (int8_t)cardId;
+}
+
+int CompactGameState::drawNextCard() {
+    if (drawCount == 0) return -1;
+
+    int cardId = drawOrder[drawHead];
+    drawHead++;
+    drawCount--;
+
+    uint64_t b = bit(cardId);
+    deckMask &= ~b;
+    discardMask |= b;
+    faceUpMask |= b;
+    topCardId = (int8_t)cardId;
+    return cardId;
+}
+
+std::vector<int> CompactGameState::getDrawStackIds() const {
+    return std::vector<int>(drawOrder + drawHead, drawOrder + drawHead + drawCount);
+}
+
+void CompactGameState::writeTo(ByteWriter& writer) const {
+    writer.writeU64(playfieldMask);
+    writer.writeU64(deckMask);
+    writer.writeU64(discardMask);
+    writer.writeU64(faceUpMask);
+    writer.writeU8((uint8_t)topCardId);
+    writer.writeU8(drawCount);
+    for (int i = 0; i < drawCount; ++i) {
+        writer.writeU8((uint8_t)drawOrder[drawHead + i]);
+    }
+}
+
+bool CompactGameState::readFrom(ByteReader& reader) {
+    *this = CompactGameState();
+    playfieldMask = reader.readU64();
+    deckMask = reader.readU64();
+    discardMask = reader.readU64();
+    faceUpMask = reader.readU64();
+    topCardId = (int8_t)reader.readU8();
+    drawCount = reader.readU8();
+    if (drawCount > kMaxCards || topCardId < -1 || topCardId >= kMaxCards) return false;
+    for (int i = 0; i < drawCount; ++i) {
+        drawOrder[i] = (int8_t)reader.readU8();
+        if (drawOrder[i] < 0 || drawOrder[i] >= kMaxCards) return false;
+    }
+    return reader.isOk();
+}
+
+bool CompactGameState::operator==(const CompactGameState& other) const {
+    if (playfieldMask != other.playfieldMask || deckMask != other.deckMask
+        || discardMask != other.discardMask || faceUpMask != other.faceUpMask
+        || topCardId != other.topCardId || drawCount != other.drawCount) {
+        return false;
+    }
+    for (int i = 0; i < drawCount; ++i) {
+        if (drawOrder[drawHead + i] != other.drawOrder[other.drawHead + i]) return false;
+    }
+    return true;
+}
+
+size_t CompactGameState::hash() const {
+    // FNV-1a 混合各掩码与有效抽牌区间
+    uint64_t h = 0xCBF29CE484222325ULL;
+    auto mix = [&h](uint64_t v) {
+        h ^= v;
+        h *= 0x100000001B3ULL;
+        h ^= h >> 29;
+    };
+    mix(playfieldMask);
+    mix(deckMask);
+    mix(discardMask);
+    mix(faceUpMask);
+    mix((uint64_t)(uint8_t)topCardId | ((uint64_t)drawCount << 8));
+    for (int i = 0; i < drawCount; ++i) {
+        mix((uint64_t)(uint8_t)drawOrder[drawHead + i]);
+    }
+    return (size_t)h;
+}
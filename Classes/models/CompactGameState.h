@@ -0,0 +1,149 @@
+#pragma once
+#include "GameConstants.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+class GameModel;
+class ByteWriter;
+class ByteReader;
+
+/**
+ * @struct CompactGameState
+ * @brief 紧凑的值类型局面 (位棋盘)
+ * @responsibility 用 4 个 64 位掩码 + 固定长度的抽牌序列描述一副 52 张牌的全部动态状态，
+ *                 可直接拷贝、比较和哈希，约 88 字节 (两个缓存行)。
+ * @usage 供求解器、AI 与服务端回放校验使用；与 GameModel 之间通过 fromModel / applyTo 无损转换。
+ *        卡牌 ID 约定与 GameModel::initStandardDeck 一致：id = suit * 13 + (face - 1)。
+ *        位置、层级等静态布局数据不属于局面，仍由 GameModel / LevelConfig 持有。
+ */
+struct CompactGameState {
+    static const int kMaxCards = 52;
+
+    uint64_t playfieldMask = 0;     ///< 位于桌面 (CardState::Playfield) 的卡牌
+    uint64_t deckMask = 0;          ///< 位于备用牌堆 (CardState::Deck) 的卡牌
+    uint64_t discardMask = 0;       ///< 位于底牌堆 (CardState::Discard) 的卡牌
+    uint64_t faceUpMask = 0;        ///< 正面朝上的卡牌
+    int8_t drawOrder[kMaxCards] = {};   ///< 抽牌序列，有效区间为 [drawHead, drawHead + drawCount)
+    uint8_t drawHead = 0;           ///< 下一张待抽牌在 drawOrder 中的下标
+    uint8_t drawCount = 0;          ///< 备用牌堆剩余张数
+    int8_t topCardId = -1;          ///< 底牌堆顶部卡牌 ID，无则为 -1
+
+    // --- 卡牌 ID 与点数/花色的换算 ---
+
+    static int faceOf(int cardId) { return cardId % 13 + 1; }
+    static int suitOf(int cardId) { return cardId / 13; }
+    static int idOf(CardFace face, CardSuit suit) { return (int)suit * 13 + (int)face - 1; }
+    static uint64_t bit(int cardId) { return 1ULL << cardId; }
+
+    /**
+     * @brief 统计掩码中的卡牌数
+     */
+    static int countOf(uint64_t mask) {
+#ifdef _MSC_VER
+        return (int)__popcnt64(mask);
+#else
+        return __builtin_popcountll(mask);
+#endif
+    }
+
+    /**
+     * @brief 取掩码中最小的卡牌 ID (mask 不能为 0)，用于逐位遍历
+     */
+    static int lowestOf(uint64_t mask) {
+#ifdef _MSC_VER
+        unsigned long index;
+        _BitScanForward64(&index, mask);
+        return (int)index;
+#else
+        return __builtin_ctzll(mask);
+#endif
+    }
+
+    /**
+     * @brief 获取某点数四种花色的卡牌掩码
+     * @param face 点数 1-13，越界返回 0
+     */
+    static uint64_t faceMask(int face) {
+        if (face < 1 || face > 13) return 0;
+        uint64_t clubs = bit(face - 1);
+        return clubs | (clubs << 13) | (clubs << 26) | (clubs << 39);
+    }
+
+    /**
+     * @brief 从 GameModel 抓取当前局面
+     * @param model 数据模型 (必须是单副 52 张牌)
+     * @param out 输出局面
+     * @return bool 模型中存在超出 0..51 的卡牌 ID 时返回 false
+     */
+    static bool fromModel(GameModel* model, CompactGameState& out);
+
+    /**
+     * @brief 将局面写回 GameModel (状态、正反面、抽牌序列与底牌 ID)
+     * @param model 目标数据模型，需已由 initStandardDeck / GameModelGenerator 创建好卡牌
+     */
+    void applyTo(GameModel* model) const;
+
+    // --- 查询 ---
+
+    bool isOnPlayfield(int cardId) const { return (playfieldMask & bit(cardId)) != 0; }
+    bool isFaceUp(int cardId) const { return (faceUpMask & bit(cardId)) != 0; }
+    int getPlayfieldCardCount() const { return countOf(playfieldMask); }
+
+    /**
+     * @brief 获取下一张待抽的牌
+     * @return int 卡牌 ID，牌堆为空返回 -1
+     */
+    int peekNextDrawCard() const { return drawCount > 0 ? drawOrder[drawHead] : -1; }
+
+    // --- 状态变更 (与 MoveCardCommand / DrawCardCommand 的数据变更一致) ---
+
+    /**
+     * @brief 将桌面牌移入底牌堆并设为堆顶
+     */
+    void moveToDiscard(int cardId);
+
+    /**
+     * @brief 从备用牌堆抽一张牌放到底牌堆顶部
+     * @return int 抽出的卡牌 ID，牌堆为空返回 -1
+     */
+    int drawNextCard();
+
+    /**
+     * @brief 按抽牌顺序输出剩余牌堆
+     */
+    std::vector<int> getDrawStackIds() const;
+
+    /**
+     * @brief 二进制序列化 (只写有效抽牌区间)，用于存档中的历史快照
+     */
+    void writeTo(ByteWriter& writer) const;
+    bool readFrom(ByteReader& reader);
+
+    bool operator==(const CompactGameState& other) const;
+    bool operator!=(const CompactGameState& other) const { return !(*this == other); }
+
+    /**
+     * @brief 计算局面哈希 (只覆盖有效的抽牌区间)
+     */
+    size_t hash() const;
+};
+
+/**
+ * @struct CompactGameStateHash
+ * @brief 供 std::unordered_set / unordered_map 使用的哈希仿函数
+ */
+struct CompactGameStateHash {
+    size_t operator()(const CompactGameState& state) const { return state.hash(); }
+};
+
+/**
+ * @brief 静态遮挡表：blockers[i] 为会压住卡牌 i 的所有卡牌掩码
+ * 位置在关卡加载后不再变化，因此每关只需计算一次。
+ */
+typedef std::array<uint64_t, CompactGameState::kMaxCards> BlockerMasks;
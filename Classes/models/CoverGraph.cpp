@@ -0,0 +1,60 @@
+#include "CoverGraph.h"
+#include <algorithm>
+
+void CoverGraph::reset(int nodeCount) {
+    _blockers.assign(nodeCount, std::vector<int>());
+    _covered.assign(nodeCount, std::vector<int>());
+}
+
+void CoverGraph::addCover(int covered, int blocker) {
+    if (covered == blocker) return;
+    if (covered < 0 || blocker < 0 || covered >= getNodeCount() || blocker >= getNodeCount()) return;
+
+    auto& blockers = _blockers[covered];
+    if (std::find(blockers.begin(), blockers.end(), blocker) != blockers.end()) return;
+
+    blockers.push_back(blocker);
+    _covered[blocker].push_back(covered);
+}
+
+CoverGraph CoverGraph::remapped(const std::vector<int>& mapping, int newNodeCount) const {
+    CoverGraph graph;
+    graph.reset(newNodeCount);
+
+    int count = std::min((int)mapping.size(), getNodeCount());
+    for (int covered = 0; covered < count; ++covered) {
+        for (int blocker : _blockers[covered]) {
+            if (blocker >= count) continue;
+            graph.addCover(mapping[covered], mapping[blocker]);
+        }
+    }
+    return graph;
+}
+
+void CoverGraph::merge(const CoverGraph& other, const std::vector<int>& mapping, int newNodeCount) {
+    if (newNodeCount > getNodeCount()) {
+        _blockers.resize(newNodeCount);
+        _covered.resize(newNodeCount);
+    }
+
+    int count = std::min((int)mapping.size(), other.getNodeCount());
+    for (int covered = 0; covered < count; ++covered) {
+        for (int blocker : other._blockers[covered]) {
+            if (blocker >= count) continue;
+            addCover(mapping[covered], mapping[blocker]);
+        }
+    }
+}
+
+BlockerMasks CoverGraph::toBlockerMasks() const {
+    BlockerMasks masks;
+    masks.fill(0);
+
+    int count = std::min(getNodeCount(), (int)CompactGameState::kMaxCards);
+    for (int covered = 0; covered < count; ++covered) {
+        for (int blocker : _blockers[covered]) {
+            if (blocker < CompactGameState::kMaxCards) masks[covered] |= CompactGameState::bit(blocker);
+        }
+    }
+    return masks;
+}
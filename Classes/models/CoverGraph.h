@@ -0,0 +1,63 @@
+#pragma once
+#include "CompactGameState.h"
+#include <cstdint>
+#include <vector>
+
+/**
+ * @class CoverGraph
+ * @brief 静态遮挡关系图
+ * @responsibility 记录“谁压住谁”的双向邻接表。卡牌位置在关卡加载后不再变化，
+ *                 因此该图每关只构建一次，之后的翻面判定只需查表。
+ * @usage LevelConfigLoader 以桌面牌下标为节点构建，GameModelGenerator 再映射为卡牌 ID 交给 GameModel。
+ */
+class CoverGraph {
+public:
+    /**
+     * @brief 清空并按节点数重新分配
+     * @param nodeCount 节点数量 (桌面牌下标或卡牌 ID 的上界)
+     */
+    void reset(int nodeCount);
+
+    /**
+     * @brief 添加一条遮挡关系：blocker 压住 covered
+     * 重复的边和自环会被忽略。
+     */
+    void addCover(int covered, int blocker);
+
+    int getNodeCount() const { return (int)_blockers.size(); }
+
+    /**
+     * @brief 获取压住该节点的所有节点
+     */
+    const std::vector<int>& getBlockers(int node) const { return _blockers[node]; }
+
+    /**
+     * @brief 获取该节点压住的所有节点
+     * 该节点离开桌面时，只有这些节点的翻面状态可能改变。
+     */
+    const std::vector<int>& getCoveredNodes(int node) const { return _covered[node]; }
+
+    /**
+     * @brief 将节点编号映射到新的编号空间 (如桌面牌下标 -> 卡牌 ID)
+     * @param mapping mapping[旧编号] = 新编号，-1 表示丢弃该节点
+     * @param newNodeCount 新编号空间的大小
+     */
+    CoverGraph remapped(const std::vector<int>& mapping, int newNodeCount) const;
+
+    /**
+     * @brief 把另一张图的边映射后并入本图 (已有的边保持不变)
+     * @param other 以其自身编号为节点的图
+     * @param mapping mapping[other 编号] = 本图编号，-1 表示丢弃该节点
+     * @param newNodeCount 本图扩展后的节点数 (小于当前节点数时不缩小)
+     */
+    void merge(const CoverGraph& other, const std::vector<int>& mapping, int newNodeCount);
+
+    /**
+     * @brief 导出为 CompactGameState 使用的 64 位遮挡掩码 (只包含编号 < 52 的节点)
+     */
+    BlockerMasks toBlockerMasks() const;
+
+private:
+    std::vector<std::vector<int>> _blockers;    ///< 节点 -> 压住它的节点
+    std::vector<std::vector<int>> _covered;     ///< 节点 -> 它压住的节点
+};
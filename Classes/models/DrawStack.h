@@ -0,0 +1,88 @@
+#pragma once
+#include <vector>
+
+/**
+ * @class DrawStack
+ * @brief 备用牌堆序列容器
+ * @responsibility 以“前端预留空位”的连续数组保存卡牌 ID，队首弹出/压回、队尾追加均为 O(1) (均摊)，
+ *                 有效区间始终连续，可零拷贝地预览接下来的若干张牌。
+ * @usage 由 GameModel 持有；下标 0 为下一张要抽的牌。
+ */
+class DrawStack {
+public:
+    /**
+     * @brief 清空序列 (保留已分配的内存)
+     */
+    void clear() {
+        _buffer.clear();
+        _head = 0;
+    }
+
+    /**
+     * @brief 预分配容量，避免初始化关卡时反复扩容
+     */
+    void reserve(int count) { _buffer.reserve(count); }
+
+    int size() const { return (int)_buffer.size() - _head; }
+    bool empty() const { return size() == 0; }
+
+    /**
+     * @brief 按抽牌顺序访问
+     * @param index 0 为下一张
+     */
+    int at(int index) const { return _buffer[_head + index]; }
+
+    /**
+     * @brief 追加到牌堆底部 (关卡初始化时使用)
+     */
+    void pushBack(int cardId) { _buffer.push_back(cardId); }
+
+    /**
+     * @brief 取出下一张牌
+     * @return int 卡牌 ID，为空返回 -1
+     */
+    int popFront() {
+        if (empty()) return -1;
+
+        int cardId = _buffer[_head++];
+        if (empty()) clear();
+        return cardId;
+    }
+
+    /**
+     * @brief 将牌放回牌堆顶部 (撤销时使用)
+     * 前端没有空位时一次性预留与当前长度相当的空位，均摊 O(1)。
+     */
+    void pushFront(int cardId) {
+        if (_head == 0) _growFront();
+        _buffer[--_head] = cardId;
+    }
+
+    /**
+     * @brief 零拷贝预览接下来的若干张牌
+     * @param count 希望预览的张数
+     * @param outCount 实际可预览的张数 (不超过剩余张数)
+     * @return const int* 指向下一张牌的指针，在下一次修改牌堆前有效
+     */
+    const int* peekNext(int count, int& outCount) const {
+        outCount = count < size() ? count : size();
+        return _buffer.data() + _head;
+    }
+
+    /**
+     * @brief 按抽牌顺序拷贝出全部剩余 ID (用于存档/调试)
+     */
+    std::vector<int> toVector() const {
+        return std::vector<int>(_buffer.begin() + _head, _buffer.end());
+    }
+
+private:
+    void _growFront() {
+        int slack = size() > 8 ? size() : 8;
+        _buffer.insert(_buffer.begin(), slack, -1);
+        _head = slack;
+    }
+
+    std::vector<int> _buffer;   ///< [_head, end) 为有效序列，[0, _head) 为前端空位
+    int _head = 0;              ///< 下一张牌在 _buffer 中的下标
+};
@@ -2,24 +2,24 @@
 
 /**
  * @file GameConstants.h
- * @brief Ϸȫֳöٶ
+ * @brief 游戏全局常量与枚举定义
  */
 
  /**
   * @enum CardSuit
-  * @brief ƻɫö
+  * @brief 卡牌花色枚举
   */
 enum class CardSuit {
     None = -1,
-    Clubs = 0,      ///< ÷
-    Diamonds = 1,   ///< 
-    Hearts = 2,     ///< 
-    Spades = 3      ///< 
+    Clubs = 0,      ///< 梅花
+    Diamonds = 1,   ///< 方块
+    Hearts = 2,     ///< 红桃
+    Spades = 3      ///< 黑桃
 };
 
 /**
  * @enum CardFace
- * @brief Ƶö
+ * @brief 卡牌点数枚举
  */
 enum class CardFace {
     None = -1,
@@ -34,11 +34,23 @@ enum class CardFace {
 
 /**
  * @enum CardState
- * @brief Ϸ״̬/λ
+ * @brief 卡牌所处的游戏状态/位置
  */
 enum class CardState {
-    Deck,       ///< ڱƶ
-    Playfield,  ///< У
-    Discard,    ///< ڷѣ/
-    Removed     ///< ƳϷռɣ
+    Deck,       ///< 在备用牌堆中
+    Playfield,  ///< 在主牌桌（七列中）
+    Discard,    ///< 在废弃堆（底牌区/手牌区）
+    Removed     ///< 已移出游戏（如已收集完成）
 };
+
+/**
+ * @brief 一副牌的张数
+ * 多副牌模式下卡牌 ID = 牌副 * kCardsPerDeck + 花色 * 13 + (点数 - 1)，单副牌时与原有 ID 完全一致。
+ */
+const int kCardsPerDeck = 52;
+
+/**
+ * @brief 同一局最多使用的牌副数
+ * MoveRecord 以 int16 保存卡牌 ID，630 副 (32760 张) 以内不会溢出。
+ */
+const int kMaxDecks = 630;
@@ -1,6 +1,8 @@
 #include "GameModel.h"
 #include "json/stringbuffer.h"
 #include "json/writer.h"
+#include "utils/BinaryStream.h"
+#include <algorithm>
 
 USING_NS_CC;
 
@@ -20,16 +22,83 @@ bool GameModel::init() {
 
 void GameModel::reset() {
     _allCards.clear();
-    // ƶУֹһֵݲ
-    _drawStackIds.clear();
+    _cardsById.clear();
+    _playfieldIds.clear();
+    _playfieldSlots.clear();
+    // 必须清空牌堆序列，防止上一局的数据残留
+    _drawStack.clear();
     _topDiscardCardId = -1;
+    _coverGraph.reset(0);
+    _activeBlockerCounts.clear();
+    _changedCardIds.clear();
+    _changedFlags.clear();
+}
+
+void GameModel::markCardChanged(int cardId) {
+    if (cardId < 0) return;
+    if (cardId >= (int)_changedFlags.size()) _changedFlags.resize(cardId + 1, 0);
+    if (_changedFlags[cardId]) return;
+
+    _changedFlags[cardId] = 1;
+    _changedCardIds.push_back(cardId);
+}
+
+void GameModel::clearChangedCards() {
+    for (int cardId : _changedCardIds) _changedFlags[cardId] = 0;
+    _changedCardIds.clear();
 }
 
 CardModel* GameModel::getCardById(int id) {
-    for (auto card : _allCards) {
-        if (card->getId() == id) return card;
+    if (id < 0 || id >= (int)_cardsById.size()) return nullptr;
+    return _cardsById[id];
+}
+
+void GameModel::addCard(CardModel* card) {
+    if (!card || card->getId() < 0) return;
+
+    _allCards.pushBack(card);
+
+    // 维护 ID 索引表，getCardById 直接按下标取
+    int id = card->getId();
+    if (id >= (int)_cardsById.size()) {
+        _cardsById.resize(id + 1, nullptr);
+        _playfieldSlots.resize(id + 1, -1);
+    }
+    _cardsById[id] = card;
+
+    // 反序列化时卡牌带着状态加入，同步登记桌面牌索引
+    if (card->getState() == CardState::Playfield && _playfieldSlots[id] < 0) {
+        _playfieldSlots[id] = (int)_playfieldIds.size();
+        _playfieldIds.push_back(id);
     }
-    return nullptr;
+}
+
+void GameModel::setCardState(CardModel* card, CardState state) {
+    if (!card) return;
+
+    int id = card->getId();
+    bool wasPlayfield = card->getState() == CardState::Playfield;
+    card->setState(state);
+    if (id < 0 || id >= (int)_playfieldSlots.size()) return;
+
+    bool isPlayfield = state == CardState::Playfield;
+    if (isPlayfield && !wasPlayfield && _playfieldSlots[id] < 0) {
+        _playfieldSlots[id] = (int)_playfieldIds.size();
+        _playfieldIds.push_back(id);
+    }
+    else if (!isPlayfield && _playfieldSlots[id] >= 0) {
+        // 与末尾交换后删除，O(1)
+        int slot = _playfieldSlots[id];
+        int lastId = _playfieldIds.back();
+        _playfieldIds[slot] = lastId;
+        _playfieldSlots[lastId] = slot;
+        _playfieldIds.pop_back();
+        _playfieldSlots[id] = -1;
+    }
+}
+
+void GameModel::mergeCoverGraph(const CoverGraph& layout, const std::vector<int>& mapping) {
+    _coverGraph.merge(layout, mapping, (int)_cardsById.size());
 }
 
 std::string GameModel::serializeToJson() {
@@ -46,8 +115,13 @@ std::string GameModel::serializeToJson() {
 
     doc.AddMember("cards", cardsArray, allocator);
 
-    // лʱ鱣浱ǰƶѵ ID УԱָ浵ʱƶ˳
-    // ʱʡԣʵ
+    // 备用牌堆顺序 (下标 0 为下一张) 与底牌 ID
+    rapidjson::Value drawArray(rapidjson::kArrayType);
+    for (int i = 0; i < _drawStack.size(); ++i) {
+        drawArray.PushBack(_drawStack.at(i), allocator);
+    }
+    doc.AddMember("drawStack", drawArray, allocator);
+    doc.AddMember("topCardId", _topDiscardCardId, allocator);
 
     rapidjson::StringBuffer buffer;
     rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
@@ -55,58 +129,165 @@ std::string GameModel::serializeToJson() {
     return buffer.GetString();
 }
 
+bool GameModel::deserializeFromJson(const std::string& json) {
+    rapidjson::Document doc;
+    doc.Parse(json.c_str());
+    if (doc.HasParseError() || !doc.IsObject() || !doc.HasMember("cards") || !doc["cards"].IsArray()) {
+        CCLOG("Error: GameModel JSON parse error");
+        return false;
+    }
+
+    this->reset();
+    for (const auto& item : doc["cards"].GetArray()) {
+        auto card = CardModel::create(0, CardFace::Ace, CardSuit::Clubs);
+        if (!card->fromJson(item) || getCardById(card->getId())) return false;
+        addCard(card);
+    }
+
+    // 与二进制存档一致：牌堆与底牌只能引用已有的卡牌
+    if (doc.HasMember("drawStack") && doc["drawStack"].IsArray()) {
+        for (const auto& id : doc["drawStack"].GetArray()) {
+            if (!id.IsInt() || !getCardById(id.GetInt())) return false;
+            _drawStack.pushBack(id.GetInt());
+        }
+    }
+    if (doc.HasMember("topCardId")) {
+        const auto& topId = doc["topCardId"];
+        if (!topId.IsInt() || (topId.GetInt() != -1 && !getCardById(topId.GetInt()))) return false;
+        _topDiscardCardId = topId.GetInt();
+    }
+    return true;
+}
+
+void GameModel::serializeToBinary(ByteWriter& writer) const {
+    // 1. 卡牌
+    writer.writeVarint((uint64_t)_allCards.size());
+    for (auto card : _allCards) {
+        card->toBinary(writer);
+    }
+
+    // 2. 备用牌堆顺序与底牌 ID (+1 使 -1 可用无符号编码)
+    writer.writeVarint((uint64_t)_drawStack.size());
+    for (int i = 0; i < _drawStack.size(); ++i) {
+        writer.writeVarint((uint64_t)_drawStack.at(i));
+    }
+    writer.writeVarint((uint64_t)(_topDiscardCardId + 1));
+
+    // 3. 遮挡图：每个节点的遮挡者列表
+    writer.writeVarint((uint64_t)_coverGraph.getNodeCount());
+    for (int node = 0; node < _coverGraph.getNodeCount(); ++node) {
+        const auto& blockers = _coverGraph.getBlockers(node);
+        writer.writeVarint((uint64_t)blockers.size());
+        for (int blocker : blockers) {
+            writer.writeVarint((uint64_t)blocker);
+        }
+    }
+}
+
+bool GameModel::deserializeFromBinary(ByteReader& reader) {
+    this->reset();
+
+    // 所有数量先与剩余字节数 (每项至少 1 字节) 和张数上限比较，再分配内存
+    const uint64_t maxCards = (uint64_t)kMaxDecks * kCardsPerDeck;
+    uint64_t cardCount = reader.readVarint();
+    if (!reader.isOk() || cardCount > maxCards || cardCount > reader.remaining()) return false;
+    for (uint64_t i = 0; i < cardCount; ++i) {
+        auto card = CardModel::create(0, CardFace::Ace, CardSuit::Clubs);
+        if (!card->fromBinary(reader) || getCardById(card->getId())) return false;
+        addCard(card);
+    }
+
+    uint64_t drawCount = reader.readVarint();
+    if (!reader.isOk() || drawCount > cardCount || drawCount > reader.remaining()) return false;
+    _drawStack.reserve((int)drawCount);
+    for (uint64_t i = 0; i < drawCount; ++i) {
+        uint64_t cardId = reader.readVarint();
+        if (cardId >= _cardsById.size() || !_cardsById[cardId]) return false;
+        _drawStack.pushBack((int)cardId);
+    }
+    uint64_t topId = reader.readVarint();
+    if (topId > _cardsById.size() || (topId > 0 && !_cardsById[topId - 1])) return false;
+    _topDiscardCardId = (int)topId - 1;
+
+    uint64_t nodeCount = reader.readVarint();
+    if (!reader.isOk() || nodeCount > _cardsById.size() || nodeCount > reader.remaining()) return false;
+    _coverGraph.reset((int)nodeCount);
+    for (uint64_t node = 0; node < nodeCount; ++node) {
+        uint64_t blockerCount = reader.readVarint();
+        if (!reader.isOk() || blockerCount > nodeCount || blockerCount > reader.remaining()) return false;
+        for (uint64_t i = 0; i < blockerCount; ++i) {
+            uint64_t blocker = reader.readVarint();
+            if (blocker >= nodeCount) return false;
+            _coverGraph.addCover((int)node, (int)blocker);
+        }
+    }
+    return reader.isOk();
+}
+
 void GameModel::initStandardDeck() {
-    // 1. 
+    initDecks(1);
+}
+
+void GameModel::initDecks(int deckCount) {
+    // 1. 清空数据
     this->reset();
+    deckCount = std::max(1, std::min(deckCount, kMaxDecks));
+
+    // 2. 按总张数一次分配，之后逐副追加不会触发扩容
+    int cardCount = deckCount * kCardsPerDeck;
+    _allCards.reserve(cardCount);
+    _cardsById.reserve(cardCount);
+    _playfieldSlots.reserve(cardCount);
+
+    // 3. 仅负责创建卡牌对象
+    // 默认状态设为 Deck，但**不要**在这里加入 _drawStack
+    // 具体的归属（在牌桌还是在备用堆）应由 Controller 根据 LevelConfig 决定
+    for (int deck = 0; deck < deckCount; ++deck) {
+        appendDeck();
+        for (int id = deck * kCardsPerDeck; id < (deck + 1) * kCardsPerDeck; ++id) {
+            _cardsById[id]->setState(CardState::Deck);
+        }
+    }
+    CCLOG("GameModel: initDecks generated %zd cards (%d decks).", _allCards.size(), deckCount);
+}
+
+int GameModel::appendDeck() {
+    int deck = getDeckCount();
+    if (deck >= kMaxDecks) return -1;
 
-    int idCounter = 0;
-    // 2. 𴴽 52 ſƶ
     for (int s = 0; s <= 3; ++s) {
         for (int f = 1; f <= 13; ++f) {
             auto card = CardModel::create(
-                idCounter++,
+                CardModel::makeId(deck, s, f),
                 static_cast<CardFace>(f),
                 static_cast<CardSuit>(s)
             );
-
-            // Ĭ״̬Ϊ Deck**Ҫ** _drawStackIds
-            // ĹڱöѣӦ Controller  LevelConfig 
-            card->setState(CardState::Deck);
-            _allCards.pushBack(card);
+            card->setState(CardState::Removed);
+            addCard(card);
         }
     }
-    CCLOG("GameModel: initStandardDeck generated %zd cards.", _allCards.size());
-}
-
-int GameModel::getPlayfieldCardCount() const {
-    int count = 0;
-    for (auto card : _allCards) {
-        if (card->getState() == CardState::Playfield) {
-            count++;
-        }
-    }
-    return count;
+    return deck;
 }
 
 void GameModel::pushToDrawStack(int cardId) {
-    //  Controller ʼؿʱõĵط
-    _drawStackIds.push_back(cardId);
+    // 这里是 Controller 初始化关卡时调用的地方
+    _drawStack.pushBack(cardId);
 }
 
 int GameModel::popNextDrawCard() {
-    if (_drawStackIds.empty()) return -1;
-
-    // ԭ߼ȡһԪΪһ
-    int id = _drawStackIds.front();
-    _drawStackIds.erase(_drawStackIds.begin());
-    return id;
+    // 取第一个元素作为下一张牌 (队首弹出，O(1))
+    return _drawStack.popFront();
 }
 
 int GameModel::getDrawStackSize() const {
-    return (int)_drawStackIds.size();
+    return _drawStack.size();
 }
 
 void GameModel::pushBackToDrawStackTop(int cardId) {
-    // ߼صǰ
-    _drawStackIds.insert(_drawStackIds.begin(), cardId);
+    // 撤销逻辑：插回到最前面 (队首压回，O(1))
+    _drawStack.pushFront(cardId);
+}
+
+const int* GameModel::peekNextDrawCards(int count, int& outCount) const {
+    return _drawStack.peekNext(count, outCount);
 }
\ No newline at end of file
@@ -1,87 +1,220 @@
 #pragma once
 #include "cocos2d.h"
 #include "CardModel.h"
+#include "CoverGraph.h"
+#include "DrawStack.h"
 #include <vector>
 #include <string>
 
+class ByteWriter;
+class ByteReader;
+
 /**
  * @class GameModel
- * @brief ȫϷģ
- * @responsibility пƶڡƶԼϷл
- * @usage ͨ Controller УΪһԴ
+ * @brief 全局游戏数据模型
+ * @responsibility 管理所有卡牌对象的生命周期、牌堆序列以及游戏快照序列化。
+ * @usage 通常由 Controller 持有，作为单一数据源。
  */
 class GameModel : public cocos2d::Ref {
 public:
     static GameModel* create();
 
     /**
-     * @brief ʼһ׼ 52 
-     * Զݲƶѡ
+     * @brief 初始化一副标准的 52 张牌
+     * 会自动清空现有数据并重置牌堆。等价于 initDecks(1)。
      */
     void initStandardDeck();
 
     /**
-     * @brief Ϸ
-     * пƺƶѼ¼
+     * @brief 初始化若干副标准牌 (会先 reset)
+     * 卡牌按 ID 连续创建，ID 表一次分配到位；ID 规则见 CardModel::makeId。
+     * @param deckCount 牌副数 (1 ~ kMaxDecks)
+     */
+    void initDecks(int deckCount);
+
+    /**
+     * @brief 追加一副新牌 (无尽模式发牌)
+     * 新牌状态为 Removed，由 GameModelGenerator 决定归属；已有卡牌指针不受影响。
+     * @return int 新牌副的序号，达到 kMaxDecks 时返回 -1
+     */
+    int appendDeck();
+
+    /**
+     * @brief 当前的牌副数
+     */
+    int getDeckCount() const { return ((int)_cardsById.size() + kCardsPerDeck - 1) / kCardsPerDeck; }
+
+    /**
+     * @brief 重置游戏数据
+     * 清空所有卡牌和牌堆记录。
      */
     void reset();
 
     /**
-     * @brief ȡп
-     * @return cocos2d::Vector<CardModel*>& б
+     * @brief 获取所有卡牌容器
+     * @return cocos2d::Vector<CardModel*>& 卡牌列表引用
      */
     cocos2d::Vector<CardModel*>& getAllCards() { return _allCards; }
 
     /**
-     * @brief  ID ҿ
-     * @param id  ID
-     * @return CardModel* ҵָ룬δҵ nullptr
+     * @brief 根据 ID 查找卡牌
+     * @param id 卡牌 ID
+     * @return CardModel* 找到返回指针，未找到返回 nullptr
+     * @note 通过 ID 索引表直接取下标，O(1)
      */
     CardModel* getCardById(int id);
 
     /**
-     * @brief лϷ״̬
-     * @return std::string JSON ַ
+     * @brief 添加卡牌并登记到 ID 索引表
+     * @param card 卡牌对象 (由 _allCards 持有引用)
+     */
+    void addCard(CardModel* card);
+
+    /**
+     * @brief 获取 ID 索引表 (下标为卡牌 ID，空位为 nullptr)
+     * 表中指针在 reset 之前保持有效，命令可直接缓存。
+     */
+    const std::vector<CardModel*>& getCardTable() const { return _cardsById; }
+
+    /**
+     * @brief 序列化整个游戏状态 (调试导出用)
+     * 包含每张牌的状态/坐标/层级、备用牌堆顺序与底牌 ID。
+     * @return std::string JSON 字符串
      */
     std::string serializeToJson();
 
-    // --- ƶ״̬ ---
+    /**
+     * @brief 从 serializeToJson 的输出恢复 (会先 reset)
+     * @return bool 解析失败、字段类型不符、ID 重复或引用不存在的卡牌时返回 false
+     * @note 遮挡图不在 JSON 中，恢复后需重新设置
+     */
+    bool deserializeFromJson(const std::string& json);
+
+    /**
+     * @brief 二进制序列化：卡牌、备用牌堆顺序、底牌 ID 与遮挡图
+     */
+    void serializeToBinary(ByteWriter& writer) const;
+
+    /**
+     * @brief 从二进制恢复 (会先 reset)，无需重新运行 GameModelGenerator
+     * @return bool 数据不完整、数量超出剩余字节或张数上限、ID 重复或越界时返回 false
+     * @note 遮挡计数不在存档中，恢复后需调用 GameRuleService::updateFaceUpStates 重建
+     */
+    bool deserializeFromBinary(ByteReader& reader);
+
+    // --- 牌堆与状态管理 ---
 
     void setTopCardId(int id) { _topDiscardCardId = id; }
     int getTopCardId() const { return _topDiscardCardId; }
 
     /**
-     * @brief ȡǰϵĿ
-     * жϷȡ
+     * @brief 修改卡牌状态并维护桌面牌索引
+     * Model 内部及 Generator / GameHistory 等修改状态时都应通过此接口，而不是直接调用 CardModel::setState。
+     */
+    void setCardState(CardModel* card, CardState state);
+
+    /**
+     * @brief 获取当前主牌桌上的卡牌数量
+     * 用于判断游戏进度。由桌面牌索引直接得出，O(1)。
+     */
+    int getPlayfieldCardCount() const { return (int)_playfieldIds.size(); }
+
+    /**
+     * @brief 当前在桌面上的卡牌 ID (无序)
+     * 规则判定只需遍历这些牌，开销与已发过多少副牌无关。
      */
-    int getPlayfieldCardCount() const;
+    const std::vector<int>& getPlayfieldCardIds() const { return _playfieldIds; }
 
     /**
-     * @brief  ID 뱸ƶβ
+     * @brief 将卡牌 ID 加入备用牌堆尾部
      */
     void pushToDrawStack(int cardId);
 
     /**
-     * @brief ӱƶȡһ
-     * @return int  ID򷵻 -1
+     * @brief 从备用牌堆取出一张牌
+     * @return int 卡牌 ID，若无牌则返回 -1
      */
     int popNextDrawCard();
 
     /**
-     * @brief ȡƶʣ
+     * @brief 获取备用牌堆剩余数量
      */
     int getDrawStackSize() const;
 
     /**
-     * @brief [Undo] ƷŻرƶѶ
-     * ڳ
+     * @brief [Undo] 将牌放回备用牌堆顶部
+     * 用于撤销操作。
      */
     void pushBackToDrawStackTop(int cardId);
 
+    /**
+     * @brief 预览接下来的若干张备用牌 (不拷贝、不改变牌堆)
+     * @param count 希望预览的张数
+     * @param outCount 实际返回的张数
+     * @return const int* 按抽牌顺序排列的卡牌 ID，在下一次修改牌堆前有效
+     */
+    const int* peekNextDrawCards(int count, int& outCount) const;
+
+    /**
+     * @brief 获取备用牌堆容器 (下标 0 为下一张)
+     */
+    const DrawStack& getDrawStack() const { return _drawStack; }
+
+    /**
+     * @brief 清空备用牌堆序列 (不改变卡牌对象本身)
+     */
+    void clearDrawStack() { _drawStack.clear(); }
+
+    // --- 遮挡关系 ---
+
+    /**
+     * @brief 设置静态遮挡图 (节点为卡牌 ID)，由 GameModelGenerator 在生成时调用
+     */
+    void setCoverGraph(const CoverGraph& graph) { _coverGraph = graph; }
+    const CoverGraph& getCoverGraph() const { return _coverGraph; }
+
+    /**
+     * @brief 把新发出的一组牌的遮挡关系并入遮挡图 (无尽模式发牌)
+     * @param layout 以布局下标为节点的遮挡图
+     * @param mapping mapping[布局下标] = 卡牌 ID，-1 表示该位置没有发牌
+     */
+    void mergeCoverGraph(const CoverGraph& layout, const std::vector<int>& mapping);
+
+    /**
+     * @brief 获取每张牌当前仍在桌面上的遮挡者数量 (下标为卡牌 ID)
+     * 由 GameRuleService 维护，计数为 0 的桌面牌即为正面。
+     */
+    std::vector<int>& getActiveBlockerCounts() { return _activeBlockerCounts; }
+
+    // --- 变更集 ---
+
+    /**
+     * @brief 记录一张牌的状态或正反面发生了变化 (同一张牌只记录一次)
+     * 由 GameHistory / GameRuleService 在修改卡牌时调用。
+     */
+    void markCardChanged(int cardId);
+
+    /**
+     * @brief 自上次 clearChangedCards 以来发生变化的卡牌 ID (按首次变化的顺序)
+     */
+    const std::vector<int>& getChangedCardIds() const { return _changedCardIds; }
+
+    /**
+     * @brief 清空变更集，复杂度与变更数量成正比
+     */
+    void clearChangedCards();
+
 private:
     bool init();
 
-    cocos2d::Vector<CardModel*> _allCards;  ///< пƵĳ
-    int _topDiscardCardId = -1;             ///< ǰƶѶĿID
-    std::vector<int> _drawStackIds;         ///< ƶѵĿID
+    cocos2d::Vector<CardModel*> _allCards;  ///< 所有卡牌的持有者
+    std::vector<CardModel*> _cardsById;     ///< 按卡牌 ID 索引的表 (不持有引用)
+    std::vector<int> _playfieldIds;         ///< 桌面牌索引 (无序，删除时与末尾交换)
+    std::vector<int> _playfieldSlots;       ///< 按卡牌 ID 记录在 _playfieldIds 中的下标 (-1 表示不在桌面)
+    int _topDiscardCardId = -1;             ///< 当前弃牌堆顶部的卡牌ID
+    CoverGraph _coverGraph;                 ///< 静态遮挡图 (卡牌 ID 空间)
+    std::vector<int> _activeBlockerCounts;  ///< 每张牌在桌面上的遮挡者数量
+    DrawStack _drawStack;                   ///< 备用牌堆的卡牌ID序列
+    std::vector<int> _changedCardIds;       ///< 变更集 (视图据此只刷新受影响的卡牌)
+    std::vector<uint8_t> _changedFlags;     ///< 按卡牌 ID 标记是否已在变更集中
 };
\ No newline at end of file
@@ -0,0 +1,109 @@
+#include "ReplayLog.h"
+#include "utils/BinaryStream.h"
+#include "cocos2d.h"
+
+USING_NS_CC;
+
+namespace {
+    const uint8_t kMagic[4] = { 'S', 'R', 'P', 'L' };
+}
+
+void ReplayLog::reset(int levelId, uint64_t seed) {
+    _levelId = levelId;
+    _seed = seed;
+    _opCount = 0;
+    _ops.clear();
+}
+
+void ReplayLog::recordClick(int cardId) {
+    if (cardId < 0) return;
+
+    if (cardId < kOpLargeClick) {
+        _appendOp((uint8_t)cardId);
+        return;
+    }
+
+    // 多副牌模式下 ID 可能超出单字节编码范围
+    _appendOp(kOpLargeClick);
+    ByteWriter(_ops).writeVarint((uint64_t)cardId);
+}
+
+bool ReplayLog::readOp(size_t& offset, Op& out) const {
+    if (offset >= _ops.size()) return false;
+
+    uint8_t code = _ops[offset++];
+    out.cardId = -1;
+    switch (code) {
+    case kOpDraw: out.type = OpType::Draw; return true;
+    case kOpUndo: out.type = OpType::Undo; return true;
+    case kOpRedo: out.type = OpType::Redo; return true;
+    case kOpLargeClick: {
+        ByteReader reader(_ops.data() + offset, _ops.size() - offset);
+        out.type = OpType::Click;
+        out.cardId = (int)reader.readVarint();
+        offset += reader.position();
+        return reader.isOk();
+    }
+    default:
+        if (code > kOpLargeClick) return false;  // 保留编码
+        out.type = OpType::Click;
+        out.cardId = code;
+        return true;
+    }
+}
+
+std::vector<uint8_t> ReplayLog::serialize() const {
+    std::vector<uint8_t> data;
+    data.reserve(_ops.size() + 24);
+
+    ByteWriter writer(data);
+    writer.writeBytes(kMagic, sizeof(kMagic));
+    writer.writeU8(kVersion);
+    writer.writeVarint((uint64_t)_levelId);
+    writer.writeU64(_seed);
+    writer.writeVarint((uint64_t)_opCount);
+    writer.writeVarint((uint64_t)_ops.size());
+    writer.writeBytes(_ops.data(), _ops.size());
+    return data;
+}
+
+bool ReplayLog::deserialize(const uint8_t* data, size_t size) {
+    ByteReader reader(data, size);
+
+    const uint8_t* magic = reader.readBytes(sizeof(kMagic));
+    if (!magic || memcmp(magic, kMagic, sizeof(kMagic)) != 0) return false;
+    if (reader.readU8() != kVersion) return false;
+
+    int levelId = (int)reader.readVarint();
+    uint64_t seed = reader.readU64();
+    uint64_t opCount = reader.readVarint();
+    size_t opBytes = (size_t)reader.readVarint();
+    const uint8_t* ops = reader.readBytes(opBytes);
+    if (!reader.isOk() || !ops || opCount > opBytes) return false;  // 每条操作至少 1 字节
+
+    reset(levelId, seed);
+    _ops.assign(ops, ops + opBytes);
+    _opCount = (int)opCount;
+    return true;
+}
+
+bool ReplayLog::saveToFile(const std::string& filename) const {
+    std::vector<uint8_t> bytes = serialize();
+
+    Data data;
+    data.copy(bytes.data(), (ssize_t)bytes.size());
+    if (!FileUtils::getInstance()->writeDataToFile(data, filename)) {
+        CCLOG("Error: Failed to write replay: %s", filename.c_str());
+        return false;
+    }
+    return true;
+}
+
+bool ReplayLog::loadFromFile(const std::string& filename) {
+    Data data = FileUtils::getInstance()->getDataFromFile(filename);
+    if (data.isNull()) {
+        CCLOG("Error: Replay file not found: %s", filename.c_str());
+        return false;
+    }
+    return deserialize(data.getBytes(), (size_t)data.getSize());
+}
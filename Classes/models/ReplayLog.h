@@ -0,0 +1,98 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @class ReplayLog
+ * @brief 紧凑的对局操作日志 (用于回放与服务端校验)
+ * @responsibility 按顺序记录玩家实际生效的操作 (点击桌面牌 / 抽牌 / 撤销 / 重做)，
+ *                 并与二进制格式互相转换。每个操作通常只占 1 字节。
+ * @usage GameController 在操作生效后调用 record* 方法；ReplayVerifier 读取并回放。
+ *
+ * 二进制格式 (小端序)：
+ *   "SRPL" | version:u8 | levelId:varint | seed:u64 | opCount:varint | opBytes:varint | ops...
+ *   操作编码：0x00-0xEF 点击该 ID 的牌；0xF0 + varint 点击大 ID 的牌；
+ *            0xFD 重做；0xFE 抽牌；0xFF 撤销。
+ */
+class ReplayLog {
+public:
+    static const uint8_t kVersion = 1;
+
+    /**
+     * @enum OpType
+     * @brief 操作类型
+     */
+    enum class OpType : uint8_t {
+        Click,  ///< 点击桌面牌 (移入底牌堆)
+        Draw,   ///< 点击备用牌堆
+        Undo,   ///< 撤销
+        Redo    ///< 重做
+    };
+
+    /**
+     * @struct Op
+     * @brief 解码后的单个操作
+     */
+    struct Op {
+        OpType type;
+        int cardId;     ///< 仅 Click 有效
+    };
+
+    /**
+     * @brief 清空并开始记录新的一局
+     * @param levelId 关卡 ID
+     * @param seed 发牌随机种子 (固定关卡为 0)
+     */
+    void reset(int levelId, uint64_t seed);
+
+    void recordClick(int cardId);
+    void recordDraw() { _appendOp(kOpDraw); }
+    void recordUndo() { _appendOp(kOpUndo); }
+    void recordRedo() { _appendOp(kOpRedo); }
+
+    int getLevelId() const { return _levelId; }
+    uint64_t getSeed() const { return _seed; }
+    int getOpCount() const { return _opCount; }
+
+    /**
+     * @brief 顺序解码操作
+     * @param offset 读取位置 (从 0 开始，成功后前移)
+     * @param out 解码结果
+     * @return bool 已到末尾或数据损坏时返回 false
+     */
+    bool readOp(size_t& offset, Op& out) const;
+
+    /**
+     * @brief 编码为二进制
+     */
+    std::vector<uint8_t> serialize() const;
+
+    /**
+     * @brief 从二进制解码
+     * @return bool 格式或版本不符时返回 false
+     */
+    bool deserialize(const uint8_t* data, size_t size);
+
+    /**
+     * @brief 写入/读取文件 (完整路径)
+     */
+    bool saveToFile(const std::string& filename) const;
+    bool loadFromFile(const std::string& filename);
+
+private:
+    static const uint8_t kOpLargeClick = 0xF0;
+    static const uint8_t kOpRedo = 0xFD;
+    static const uint8_t kOpDraw = 0xFE;
+    static const uint8_t kOpUndo = 0xFF;
+
+    void _appendOp(uint8_t code) {
+        _ops.push_back(code);
+        _opCount++;
+    }
+
+    int _levelId = 0;
+    uint64_t _seed = 0;
+    int _opCount = 0;
+    std::vector<uint8_t> _ops;  ///< 已编码的操作序列
+};
@@ -1,71 +1,150 @@
 #include "GameModelGenerator.h"
+#include "GameRuleService.h"
+#include <random>
 
 USING_NS_CC;
 
 void GameModelGenerator::generate(GameModel* model, const LevelConfig& config) {
     if (!model) return;
 
-    // 1. ʼ׼ 52 ƶ
-    model->initStandardDeck();
+    // 1. 按配置用到的牌副数初始化卡牌对象池 (单副牌关卡即标准 52 张)
+    model->initDecks(config.getDeckCount());
 
-    // 2. ȽƱΪ Removed (ĬϲϷ)
+    // 2. 先将所有牌标记为 Removed (默认不参与游戏)
     for (auto card : model->getAllCards()) {
-        card->setState(CardState::Removed);
+        model->setCardState(card, CardState::Removed);
     }
 
-    // 3. ֲװ
-    _setupPlayfield(model, config);
+    // 3. 分步组装数据
+    std::vector<int> playfieldIds = _setupPlayfield(model, config);
     _setupDrawStack(model, config);
+    _setupCoverGraph(model, config, playfieldIds);
 }
 
-CardModel* GameModelGenerator::_findCard(GameModel* model, int face, int suit) {
-    auto& allCards = model->getAllCards();
-    for (auto card : allCards) {
-        if ((int)card->getFace() == face && (int)card->getSuit() == suit) {
-            return card;
-        }
-    }
-    return nullptr;
+CardModel* GameModelGenerator::_resolveCard(GameModel* model, const CardConfigData& cfgData) {
+    // 卡牌 ID 由 (牌副, 花色, 点数) 直接算出，不再线性查找
+    return model->getCardById(CardModel::makeId(cfgData.deck, cfgData.cardSuit, cfgData.cardFace));
 }
 
-void GameModelGenerator::_setupPlayfield(GameModel* model, const LevelConfig& config) {
+std::vector<int> GameModelGenerator::_setupPlayfield(GameModel* model, const LevelConfig& config) {
+    std::vector<int> playfieldIds;
+    playfieldIds.reserve(config.playfieldCards.size());
+
     for (const auto& cfgData : config.playfieldCards) {
-        CardModel* card = _findCard(model, cfgData.cardFace, cfgData.cardSuit);
+        CardModel* card = _resolveCard(model, cfgData);
+        playfieldIds.push_back(card ? card->getId() : -1);
         if (card) {
-            card->setState(CardState::Playfield);
+            model->setCardState(card, CardState::Playfield);
             card->setPosition(Vec2(cfgData.x, cfgData.y));
             card->setZOrder(cfgData.zOrder);
-            // ʼ״̬ Config  (ͨһ)
+            // 初始翻面状态由 Config 决定 (通常第一排是正面的)
             card->setFaceUp(cfgData.isFaceUp);
         }
     }
+
+    return playfieldIds;
 }
 
 void GameModelGenerator::_setupDrawStack(GameModel* model, const LevelConfig& config) {
     bool isFirst = true;
 
-    // ԼdrawStackCards беĵһԪΪơΪƶѡ
+    // 约定：drawStackCards 配置列表中的第一个元素作为“底牌”，其余作为“备用牌堆”
     for (const auto& cfgData : config.drawStackCards) {
-        CardModel* card = _findCard(model, cfgData.cardFace, cfgData.cardSuit);
+        CardModel* card = _resolveCard(model, cfgData);
         if (!card) continue;
 
         if (isFirst) {
-            // óʼ (Base Card)
-            card->setState(CardState::Discard);
+            // 设置初始底牌 (Base Card)
+            model->setCardState(card, CardState::Discard);
             card->setFaceUp(true);
-            // λù̶齫 View/Config ȡ
+            // 底牌位置固定，建议将来从 View/Config 获取常量
             card->setPosition(Vec2(540, 300));
 
             model->setTopCardId(card->getId());
             isFirst = false;
         }
         else {
-            // ƽ뱸ƶ
-            card->setState(CardState::Deck);
+            // 其余牌进入备用牌堆
+            model->setCardState(card, CardState::Deck);
             card->setFaceUp(false);
 
-            // [ؼ] 뽫 ID б popNextDrawCard ޷
+            // [关键] 必须将 ID 加入有序列表，否则 popNextDrawCard 无法工作
             model->pushToDrawStack(card->getId());
         }
     }
-}
\ No newline at end of file
+}
+
+void GameModelGenerator::_setupCoverGraph(GameModel* model, const LevelConfig& config,
+    const std::vector<int>& playfieldIds) {
+    // 手工拼装的 LevelConfig 可能没有经过 LevelConfigLoader，此时现场构建
+    CoverGraph layout = config.coverGraph;
+    if (layout.getNodeCount() != (int)config.playfieldCards.size()) {
+        layout = GameRuleService::buildCoverGraph(config.playfieldCards);
+    }
+
+    // 同一张牌在配置中出现多次时，只有最后一次的位置生效 (与 _setupPlayfield 一致)
+    int cardCount = (int)model->getAllCards().size();
+    std::vector<int> lastIndex(cardCount, -1);
+    for (int i = 0; i < (int)playfieldIds.size(); ++i) {
+        if (playfieldIds[i] >= 0) lastIndex[playfieldIds[i]] = i;
+    }
+
+    std::vector<int> mapping = playfieldIds;
+    for (int i = 0; i < (int)mapping.size(); ++i) {
+        if (mapping[i] >= 0 && lastIndex[mapping[i]] != i) mapping[i] = -1;
+    }
+
+    model->setCoverGraph(layout.remapped(mapping, cardCount));
+}
+
+int GameModelGenerator::dealDeck(GameModel* model, const std::vector<CardConfigData>& layout,
+    const CoverGraph& layoutGraph, uint64_t seed) {
+    if (!model) return -1;
+
+    // 1. 追加新牌副并洗牌 (Fisher-Yates，与 LevelGenerator 一样只依赖 mt19937_64 的输出，跨平台可复现)
+    int deck = model->appendDeck();
+    if (deck < 0) return -1;
+
+    std::vector<int> order(kCardsPerDeck);
+    for (int i = 0; i < kCardsPerDeck; ++i) order[i] = deck * kCardsPerDeck + i;
+    std::mt19937_64 rng(seed);
+    for (int i = kCardsPerDeck - 1; i > 0; --i) {
+        int j = (int)(rng() % (uint64_t)(i + 1));
+        std::swap(order[i], order[j]);
+    }
+
+    // 2. 前若干张按布局发到桌面
+    int dealt = std::min((int)layout.size(), kCardsPerDeck);
+    std::vector<int> mapping(layout.size(), -1);
+    std::vector<int> dealtIds;
+    dealtIds.reserve(dealt);
+    for (int i = 0; i < dealt; ++i) {
+        CardModel* card = model->getCardById(order[i]);
+        model->setCardState(card, CardState::Playfield);
+        card->setPosition(cocos2d::Vec2(layout[i].x, layout[i].y));
+        card->setZOrder(layout[i].zOrder);
+        card->setFaceUp(false);
+        model->markCardChanged(card->getId());
+
+        mapping[i] = card->getId();
+        dealtIds.push_back(card->getId());
+    }
+
+    // 3. 其余接到备用牌堆末尾
+    for (int i = dealt; i < kCardsPerDeck; ++i) {
+        CardModel* card = model->getCardById(order[i]);
+        model->setCardState(card, CardState::Deck);
+        card->setFaceUp(false);
+        model->pushToDrawStack(card->getId());
+    }
+
+    // 4. 并入遮挡关系并只为新牌计算翻面
+    if (layoutGraph.getNodeCount() == (int)layout.size()) {
+        model->mergeCoverGraph(layoutGraph, mapping);
+    }
+    else {
+        model->mergeCoverGraph(GameRuleService::buildCoverGraph(layout), mapping);
+    }
+    GameRuleService::onCardsDealt(model, dealtIds);
+    return deck;
+}
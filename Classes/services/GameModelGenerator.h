@@ -1,28 +1,45 @@
 #pragma once
 #include "models/GameModel.h"
 #include "configs/LevelConfig.h"
+#include <cstdint>
 
 /**
  * @class GameModelGenerator
- * @brief Ϸ
- * @responsibility ݾ̬ LevelConfig ãװ GameModel ĳʼ״̬
+ * @brief 游戏数据生成器
+ * @responsibility 根据静态 LevelConfig 配置，组装并填充 GameModel 的初始状态。
  */
 class GameModelGenerator {
 public:
     /**
-     * @brief Ϸؿ
-     * @param model Ŀģ (ò)
-     * @param config ؿ
+     * @brief 生成游戏关卡数据
+     * @param model 目标数据模型 (将被重置并填充)
+     * @param config 关卡配置数据 (按其中用到的牌副数创建卡牌)
      */
     static void generate(GameModel* model, const LevelConfig& config);
 
+    /**
+     * @brief 无尽模式发牌：追加一副洗好的新牌，按布局发到桌面，其余接到备用牌堆末尾
+     * 只触及新牌副的 52 张牌与布局的遮挡边，开销与已发过的牌副数无关。
+     * @param model 数据模型 (已有的卡牌不受影响)
+     * @param layout 桌面布局 (只使用坐标与层级，超过 52 个位置的部分不发牌)
+     * @param layoutGraph 以布局下标为节点的遮挡图 (节点数不符时现场构建)
+     * @param seed 洗牌种子 (相同种子发出相同的牌)
+     * @return int 新牌副的序号，牌副数已达上限时返回 -1
+     */
+    static int dealDeck(GameModel* model, const std::vector<CardConfigData>& layout,
+        const CoverGraph& layoutGraph, uint64_t seed);
+
 private:
-    // ݻɫҿƶ
-    static CardModel* _findCard(GameModel* model, int face, int suit);
+    // 辅助函数：按 (牌副, 花色, 点数) 直接定位卡牌对象，O(1)
+    static CardModel* _resolveCard(GameModel* model, const CardConfigData& cfgData);
 
-    // 裺
-    static void _setupPlayfield(GameModel* model, const LevelConfig& config);
+    // 辅助步骤：处理主牌桌布局
+    // 返回每个桌面牌配置项对应的卡牌 ID (找不到为 -1)
+    static std::vector<int> _setupPlayfield(GameModel* model, const LevelConfig& config);
 
-    // 裺ƶ
+    // 辅助步骤：处理备用牌堆与底牌
     static void _setupDrawStack(GameModel* model, const LevelConfig& config);
+
+    // 辅助步骤：把配置中的遮挡图映射到卡牌 ID 空间并交给 Model
+    static void _setupCoverGraph(GameModel* model, const LevelConfig& config, const std::vector<int>& playfieldIds);
 };
\ No newline at end of file
@@ -1,20 +1,22 @@
 #pragma once
-#include "models/CardModel.h"
+#include "models/GameModel.h"
+#include "models/CompactGameState.h"
+#include "configs/LevelConfig.h"
 #include <cmath>
 
 /**
  * @class GameRuleService
- * @brief Ϸж
- * @responsibility ṩ̬ƥּԼڵ棩߼
- * @usage ״ֱ̬࣬ӵþ̬
+ * @brief 游戏规则判定服务
+ * @responsibility 提供纯静态方法，处理接龙匹配规则、死局检测以及卡牌遮挡（翻面）逻辑。
+ * @usage 无状态工具类，直接调用静态方法。
  */
 class GameRuleService {
 public:
     /**
-     * @brief жǷԽĿƺ
-     * 򣺵ľֵΪ 1
-     * @param handCard Ŀ
-     * @param targetCard ǰĵ
+     * @brief 判断手牌是否可以接在目标牌后面
+     * 规则：点数差的绝对值为 1。
+     * @param handCard 点击的卡牌
+     * @param targetCard 当前的底牌
      */
     static bool canMatch(CardModel* handCard, CardModel* targetCard) {
         if (!handCard || !targetCard) return false;
@@ -22,12 +24,33 @@ public:
         int faceA = (int)handCard->getFace();
         int faceB = (int)targetCard->getFace();
         int diff = std::abs(faceA - faceB);
-        return diff == 1; // ݲ֧ A-K ѭֵ֧
+        return diff == 1; // 暂不支持 A-K 循环，仅支持算术差值
     }
 
     /**
-     * @brief 鵱ǰǷн
-     * жϷʧܡ
+     * @brief canMatch 的卡牌 ID 版本 (用于 CompactGameState)
+     * @param handCardId 点击的卡牌 ID
+     * @param targetCardId 当前的底牌 ID
+     */
+    static bool canMatch(int handCardId, int targetCardId) {
+        if (handCardId < 0 || targetCardId < 0) return false;
+        int diff = std::abs(CompactGameState::faceOf(handCardId) - CompactGameState::faceOf(targetCardId));
+        return diff == 1;
+    }
+
+    /**
+     * @brief 获取所有能接在目标牌上的卡牌掩码 (点数差为 1)
+     * @param targetCardId 当前的底牌 ID，无底牌时返回 0
+     */
+    static uint64_t getMatchMask(int targetCardId) {
+        if (targetCardId < 0) return 0;
+        int face = CompactGameState::faceOf(targetCardId);
+        return CompactGameState::faceMask(face - 1) | CompactGameState::faceMask(face + 1);
+    }
+
+    /**
+     * @brief 检查当前局面是否有解
+     * 用于判定游戏失败。只遍历桌面牌索引，多副牌时开销与已发出的牌副数无关。
      */
     static bool hasAnyMove(GameModel* model) {
         if (!model) return false;
@@ -36,55 +59,192 @@ public:
         auto topCard = model->getCardById(topId);
         if (!topCard) return false;
 
-        for (auto card : model->getAllCards()) {
-            if (card->getState() == CardState::Playfield && card->isFaceUp()) {
-                if (canMatch(card, topCard)) {
-                    return true;
-                }
+        for (int cardId : model->getPlayfieldCardIds()) {
+            auto card = model->getCardById(cardId);
+            if (card->isFaceUp() && canMatch(card, topCard)) {
+                return true;
             }
         }
         return false;
     }
 
     /**
-     * @brief ˢпƵķ״̬
-     *  Playfield еĿƣλ·ڵΪ档
+     * @brief hasAnyMove 的 CompactGameState 版本
+     * 只判断桌面上是否有可点击的牌，与 GameModel 版本一致。
+     */
+    static bool hasAnyMove(const CompactGameState& state) {
+        uint64_t clickable = state.playfieldMask & state.faceUpMask;
+        return (clickable & getMatchMask(state.topCardId)) != 0;
+    }
+
+    /**
+     * @brief 刷新所有卡牌的翻面状态 (全量)
+     * 根据 GameModel 中的静态遮挡图重新统计每张牌在桌面上的遮挡者数量，
+     * 计数为 0 的桌面牌设为正面。复杂度 O(n + e)，只需在开局时调用一次。
      */
     static void updateFaceUpStates(GameModel* model) {
-        auto& allCards = model->getAllCards();
+        const CoverGraph& graph = model->getCoverGraph();
+        auto& counts = model->getActiveBlockerCounts();
+        counts.assign(graph.getNodeCount(), 0);
+
+        const auto& playfieldIds = model->getPlayfieldCardIds();
+        for (int id : playfieldIds) {
+            if (id >= graph.getNodeCount()) continue;
+
+            for (int coveredId : graph.getCoveredNodes(id)) {
+                counts[coveredId]++;
+            }
+        }
+
+        for (int id : playfieldIds) {
+            auto card = model->getCardById(id);
+            bool faceUp = id >= graph.getNodeCount() || counts[id] == 0;
+            if (card->isFaceUp() == faceUp) continue;
+            card->setFaceUp(faceUp);
+            model->markCardChanged(id);
+        }
+    }
 
-        for (auto cardA : allCards) {
-            if (cardA->getState() != CardState::Playfield) continue;
+    /**
+     * @brief 增量更新：一组牌刚发到桌面 (无尽模式发牌)
+     * 新牌的遮挡关系只涉及新牌自身，只统计这些牌，复杂度 O(k + e)，与已有的牌数无关。
+     * @param model 数据模型 (新牌已设为 Playfield，遮挡图已合并)
+     * @param cardIds 新发出的桌面牌 ID
+     */
+    static void onCardsDealt(GameModel* model, const std::vector<int>& cardIds) {
+        const CoverGraph& graph = model->getCoverGraph();
+        auto& counts = model->getActiveBlockerCounts();
+        if ((int)counts.size() < graph.getNodeCount()) counts.resize(graph.getNodeCount(), 0);
+        for (int id : cardIds) {
+            if (id >= 0 && id < (int)counts.size()) counts[id] = 0;
+        }
+
+        for (int id : cardIds) {
+            if (id < 0 || id >= graph.getNodeCount()) continue;
+            for (int coveredId : graph.getCoveredNodes(id)) {
+                counts[coveredId]++;
+            }
+        }
+
+        for (int id : cardIds) {
+            auto card = model->getCardById(id);
+            if (!card || card->getState() != CardState::Playfield) continue;
+
+            bool faceUp = id >= graph.getNodeCount() || counts[id] == 0;
+            if (card->isFaceUp() == faceUp) continue;
+            card->setFaceUp(faceUp);
+            model->markCardChanged(id);
+        }
+    }
 
-            bool isCovered = false;
-            // Ƿκһ B ס A
-            for (auto cardB : allCards) {
-                if (cardA == cardB) continue;
-                if (cardB->getState() != CardState::Playfield) continue;
+    /**
+     * @brief 增量更新：某张牌刚离开桌面
+     * 只重新判定它压住的那些牌，复杂度 O(k)。
+     * @param model 数据模型 (卡牌状态已改为离开桌面)
+     * @param cardId 离开桌面的卡牌 ID
+     */
+    static void onCardLeftPlayfield(GameModel* model, int cardId) {
+        const CoverGraph& graph = model->getCoverGraph();
+        auto& counts = model->getActiveBlockerCounts();
+        if (cardId < 0 || cardId >= graph.getNodeCount()) return;
+
+        for (int coveredId : graph.getCoveredNodes(cardId)) {
+            if (--counts[coveredId] > 0) continue;
+
+            auto card = model->getCardById(coveredId);
+            if (card && card->getState() == CardState::Playfield && !card->isFaceUp()) {
+                card->setFaceUp(true);
+                model->markCardChanged(coveredId);
+            }
+        }
+    }
+
+    /**
+     * @brief 增量更新：某张牌回到桌面 (撤销)
+     * 它压住的牌重新变为背面，它自己按当前遮挡者数量决定正反面。
+     * @param model 数据模型 (卡牌状态已恢复为 Playfield)
+     * @param cardId 回到桌面的卡牌 ID
+     */
+    static void onCardReturnedToPlayfield(GameModel* model, int cardId) {
+        const CoverGraph& graph = model->getCoverGraph();
+        auto& counts = model->getActiveBlockerCounts();
+        if (cardId < 0 || cardId >= graph.getNodeCount()) return;
+
+        for (int coveredId : graph.getCoveredNodes(cardId)) {
+            if (counts[coveredId]++ > 0) continue;
+
+            auto card = model->getCardById(coveredId);
+            if (card && card->getState() == CardState::Playfield && card->isFaceUp()) {
+                card->setFaceUp(false);
+                model->markCardChanged(coveredId);
+            }
+        }
+
+        auto card = model->getCardById(cardId);
+        if (card && card->isFaceUp() != (counts[cardId] == 0)) {
+            card->setFaceUp(counts[cardId] == 0);
+            model->markCardChanged(cardId);
+        }
+    }
+
+    /**
+     * @brief updateFaceUpStates 的 CompactGameState 版本
+     * 桌面牌只要没有任何遮挡者仍在桌面上即为正面，非桌面牌保持不变。
+     * @param state 待更新的局面
+     * @param blockers 由 buildBlockerMasks 预先计算的静态遮挡表
+     */
+    static void updateFaceUpStates(CompactGameState& state, const BlockerMasks& blockers) {
+        uint64_t playfield = state.playfieldMask;
+        uint64_t faceUp = 0;
+        for (uint64_t rest = playfield; rest; rest &= rest - 1) {
+            int id = CompactGameState::lowestOf(rest);
+            if ((blockers[id] & playfield) == 0) faceUp |= CompactGameState::bit(id);
+        }
+        state.faceUpMask = (state.faceUpMask & ~playfield) | faceUp;
+    }
+
+    /**
+     * @brief 导出 CompactGameState 使用的静态遮挡表
+     * @param model 已生成好的数据模型 (单副 52 张牌；多副牌时编号 >= 52 的节点被忽略)
+     */
+    static BlockerMasks buildBlockerMasks(GameModel* model) {
+        return model->getCoverGraph().toBlockerMasks();
+    }
+
+    /**
+     * @brief 根据桌面牌配置构建静态遮挡图
+     * 位置在关卡加载后不再变化，由 LevelConfigLoader 每关调用一次。
+     * @param cards 桌面牌配置列表
+     * @return CoverGraph 以列表下标为节点的遮挡图
+     */
+    static CoverGraph buildCoverGraph(const std::vector<CardConfigData>& cards) {
+        CoverGraph graph;
+        graph.reset((int)cards.size());
 
-                if (_isCoveredBy(cardA, cardB)) {
-                    isCovered = true;
-                    break;
-                }
+        for (int a = 0; a < (int)cards.size(); ++a) {
+            cocos2d::Vec2 posA(cards[a].x, cards[a].y);
+            for (int b = 0; b < (int)cards.size(); ++b) {
+                if (a == b) continue;
+                if (_isCoveredBy(posA, cocos2d::Vec2(cards[b].x, cards[b].y))) graph.addCover(a, b);
             }
-            cardA->setFaceUp(!isCovered);
         }
+        return graph;
     }
 
 private:
-    // жֵ (زĳߴ)
+    // 判定阈值 (根据素材尺寸调整)
     static constexpr float kCheckWidth = 100.0f;
     static constexpr float kCheckHeight = 120.0f;
 
     /**
-     * @brief ж cardB Ƿס cardA
-     * TriPeaks Уλ·(YС)ƻѹסϷơ
+     * @brief 判定位于 posB 的牌是否盖住了位于 posA 的牌
+     * 规则：TriPeaks 中，位于下方(Y更小)的牌会压住上方的牌。
      */
-    static bool _isCoveredBy(CardModel* cardA, CardModel* cardB) {
-        // ֻе B  A · (YֵС) ʱſܹڵ
-        if (cardB->getPosition().y < cardA->getPosition().y) {
-            float diffX = std::abs(cardA->getPosition().x - cardB->getPosition().x);
-            float diffY = std::abs(cardA->getPosition().y - cardB->getPosition().y);
+    static bool _isCoveredBy(const cocos2d::Vec2& posA, const cocos2d::Vec2& posB) {
+        // 只有当 B 在 A 的下方 (Y值更小) 时，才可能构成遮挡
+        if (posB.y < posA.y) {
+            float diffX = std::abs(posA.x - posB.x);
+            float diffY = std::abs(posA.y - posB.y);
 
             if (diffX < kCheckWidth && diffY < kCheckHeight) {
                 return true;
@@ -0,0 +1,181 @@
+#include "HintSearch.h"
+#include "GameRuleService.h"
+#include "LevelSolver.h"
+#include "models/GameModel.h"
+#include <algorithm>
+#include <climits>
+
+namespace {
+    const int kWinScore = 1000000;          ///< 胜局估值基准
+    const int kLossScore = -1000000;        ///< 死局估值基准
+    const int kCheckInterval = 256;         ///< 每展开多少节点检查一次时间与取消标记
+    const size_t kMaxTableSize = 1 << 16;   ///< 置换表上限，超出后清空 (约 8MB 以内)
+    const int kExactDepth = INT_MAX;        ///< 置换表深度标记：子树未被截断，结果与深度无关
+}
+
+HintResult HintSearch::search(const CompactGameState& start, const BlockerMasks& blockers,
+    const HintOptions& options, const std::atomic<bool>* cancel) {
+    HintResult result;
+
+    // 1. 根节点的合法操作：先点击桌面牌，最后抽牌 (估值相同时优先不消耗牌堆的操作)
+    uint64_t clickable = start.playfieldMask & start.faceUpMask & GameRuleService::getMatchMask(start.topCardId);
+    bool canDraw = start.drawCount > 0;
+    if (start.playfieldMask == 0 || (!clickable && !canDraw)) return result;
+
+    std::vector<SolverMove> rootMoves;
+    for (uint64_t rest = clickable; rest; rest &= rest - 1) {
+        rootMoves.push_back({ false, CompactGameState::lowestOf(rest) });
+    }
+    if (canDraw) rootMoves.push_back({ true, start.peekNextDrawCard() });
+
+    // 只有一个选择时无需搜索
+    result.valid = true;
+    result.isDraw = rootMoves[0].isDraw;
+    result.cardId = rootMoves[0].cardId;
+    if (rootMoves.size() == 1) return result;
+
+    // 2. 迭代加深：每完成一层更新最佳首步
+    HintSearch searcher(blockers, options, cancel);
+    for (int depth = 1; depth <= options.maxDepth; ++depth) {
+        searcher._hitDepthLimit = false;
+
+        int bestValue = INT_MIN;
+        const SolverMove* best = nullptr;
+        for (const auto& move : rootMoves) {
+            CompactGameState next = start;
+            if (move.isDraw) {
+                next.drawNextCard();
+            }
+            else {
+                next.moveToDiscard(move.cardId);
+                GameRuleService::updateFaceUpStates(next, blockers);
+            }
+
+            int value = searcher._search(next, depth - 1);
+            if (searcher._aborted) break;
+            if (value > bestValue) {
+                bestValue = value;
+                best = &move;
+            }
+        }
+        if (searcher._aborted) break;
+
+        result.isDraw = best->isDraw;
+        result.cardId = best->cardId;
+        result.depth = depth;
+        result.winning = bestValue >= kWinScore;
+
+        // 已找到必胜路线 (迭代加深保证步数最少)，或整棵树已搜完
+        if (result.winning || !searcher._hitDepthLimit) break;
+    }
+
+    result.nodes = searcher._nodes;
+    return result;
+}
+
+HintResult HintSearch::firstLegalMove(GameModel* model) {
+    HintResult result;
+    if (!model || model->getPlayfieldCardCount() == 0) return result;
+
+    // 1. 点击桌面牌 (与 search 一致，取编号最小的一张)
+    auto topCard = model->getCardById(model->getTopCardId());
+    if (topCard) {
+        for (int cardId : model->getPlayfieldCardIds()) {
+            auto card = model->getCardById(cardId);
+            if (!card->isFaceUp() || !GameRuleService::canMatch(card, topCard)) continue;
+            if (!result.valid || cardId < result.cardId) {
+                result.valid = true;
+                result.cardId = cardId;
+            }
+        }
+        if (result.valid) return result;
+    }
+
+    // 2. 抽牌
+    int count = 0;
+    const int* next = model->peekNextDrawCards(1, count);
+    if (count > 0) {
+        result.valid = true;
+        result.isDraw = true;
+        result.cardId = next[0];
+    }
+    return result;
+}
+
+HintSearch::HintSearch(const BlockerMasks& blockers, const HintOptions& options, const std::atomic<bool>* cancel)
+    : _blockers(blockers), _options(options), _cancel(cancel),
+    _deadline(std::chrono::steady_clock::now() + std::chrono::milliseconds(options.budgetMs))
+{
+}
+
+bool HintSearch::_shouldStop() {
+    if (_aborted) return true;
+    if (++_nodes % kCheckInterval != 0) return false;
+
+    if ((_cancel && _cancel->load(std::memory_order_relaxed)) || std::chrono::steady_clock::now() >= _deadline) {
+        _aborted = true;
+    }
+    return _aborted;
+}
+
+int HintSearch::_evaluate(const CompactGameState& state) {
+    // 胜局：剩余牌堆越多 (抽牌越少) 越好
+    if (state.playfieldMask == 0) return kWinScore + state.drawCount;
+
+    int remaining = state.getPlayfieldCardCount();
+    int faceUp = CompactGameState::countOf(state.playfieldMask & state.faceUpMask);
+    int score = -remaining * 100 + faceUp * 10 + state.drawCount * 2;
+
+    // 死局：无论估值如何都劣于仍可继续的局面
+    bool canClick = GameRuleService::hasAnyMove(state);
+    if (!canClick && state.drawCount == 0) score += kLossScore;
+    return score;
+}
+
+int HintSearch::_search(const CompactGameState& state, int depth) {
+    if (_shouldStop()) return 0;
+
+    uint64_t clickable = state.playfieldMask & state.faceUpMask & GameRuleService::getMatchMask(state.topCardId);
+    bool canDraw = state.drawCount > 0;
+    if (state.playfieldMask == 0 || (!clickable && !canDraw)) return _evaluate(state);
+    if (depth == 0) {
+        _hitDepthLimit = true;
+        return _evaluate(state);
+    }
+
+    // 置换表：同一局面在不少于当前剩余深度下的结果可直接复用
+    auto it = _table.find(state);
+    if (it != _table.end() && it->second.depth >= depth) {
+        if (it->second.depth != kExactDepth) _hitDepthLimit = true;
+        return it->second.value;
+    }
+
+    // 单独统计本子树是否被截断，用于标记置换表项能否在更深的迭代中复用
+    bool outerHitLimit = _hitDepthLimit;
+    _hitDepthLimit = false;
+
+    int best = INT_MIN;
+    for (uint64_t rest = clickable; rest; rest &= rest - 1) {
+        CompactGameState next = state;
+        next.moveToDiscard(CompactGameState::lowestOf(rest));
+        GameRuleService::updateFaceUpStates(next, _blockers);
+
+        best = std::max(best, _search(next, depth - 1));
+        if (_aborted) return 0;
+        if (best >= kWinScore) break;   // 已能获胜即可，不再比较抽牌更少的胜法
+    }
+
+    if (canDraw && best < kWinScore) {
+        CompactGameState next = state;
+        next.drawNextCard();
+        best = std::max(best, _search(next, depth - 1));
+        if (_aborted) return 0;
+    }
+
+    bool truncated = _hitDepthLimit;
+    _hitDepthLimit = outerHitLimit || truncated;
+
+    if (_table.size() >= kMaxTableSize) _table.clear();
+    _table[state] = { truncated ? depth : kExactDepth, best };
+    return best;
+}
@@ -0,0 +1,96 @@
+#pragma once
+#include "models/CompactGameState.h"
+#include <atomic>
+#include <chrono>
+#include <unordered_map>
+
+class GameModel;
+
+/**
+ * @struct HintOptions
+ * @brief 提示搜索参数
+ */
+struct HintOptions {
+    int budgetMs = 150;     ///< 单次搜索的时间上限 (毫秒)
+    int maxDepth = 48;      ///< 迭代加深的最大步数
+};
+
+/**
+ * @struct HintResult
+ * @brief 提示结果：建议的下一步操作
+ */
+struct HintResult {
+    bool valid = false;     ///< 是否存在可建议的操作 (无任何合法操作时为 false)
+    bool isDraw = false;    ///< true 为点击备用牌堆，false 为点击 cardId
+    int cardId = -1;        ///< 建议点击的桌面牌 ID (isDraw 时为将被抽出的牌)
+    int depth = 0;          ///< 完成的搜索深度 (步)
+    bool winning = false;   ///< 在该深度内找到了必胜路线
+    long long nodes = 0;    ///< 展开的搜索节点数
+};
+
+/**
+ * @class HintSearch
+ * @brief 限时前瞻的提示搜索
+ * @responsibility 在 CompactGameState 上对“点击桌面牌/抽牌”做迭代加深搜索，
+ *                 抽牌序列已知，因此前瞻会考虑之后抽到的牌；叶子按剩余桌面牌、翻开的牌与剩余牌堆估值。
+ *                 每完成一层深度就更新一次最佳首步，超时或被取消时返回最近完成的一层的结果。
+ * @usage 纯值类型运算，可在工作线程调用；由 HintManager 在后台驱动，也可供工具直接调用。
+ */
+class HintSearch {
+public:
+    /**
+     * @brief 搜索当前局面的最佳下一步
+     * @param start 当前局面 (翻面状态需已是最新)
+     * @param blockers 该关卡的静态遮挡表
+     * @param options 时间与深度上限
+     * @param cancel 取消标记 (可为 nullptr)，置位后搜索尽快返回
+     * @return HintResult 最近完成的一层深度给出的建议；第一层都未完成时退化为第一个合法操作
+     */
+    static HintResult search(const CompactGameState& start, const BlockerMasks& blockers,
+        const HintOptions& options = HintOptions(), const std::atomic<bool>* cancel = nullptr);
+
+    /**
+     * @brief 不做前瞻，直接返回第一个合法操作 (与 search 的退化结果规则相同)
+     * 用于无法转换为 CompactGameState 的局面 (如无尽模式发出第二副牌之后)。
+     * @param model 当前数据模型 (翻面状态需已是最新)
+     * @return HintResult 编号最小的可点击桌面牌，其次为抽牌；都没有时 valid 为 false
+     */
+    static HintResult firstLegalMove(GameModel* model);
+
+private:
+    HintSearch(const BlockerMasks& blockers, const HintOptions& options, const std::atomic<bool>* cancel);
+
+    /**
+     * @brief 深度受限的最大值搜索
+     * @return int 在 depth 步内可达到的最高估值 (中止时返回值无意义)
+     */
+    int _search(const CompactGameState& state, int depth);
+
+    /**
+     * @brief 静态估值：胜局最高，死局最低，其余按局面进度
+     */
+    static int _evaluate(const CompactGameState& state);
+
+    /**
+     * @brief 每隔若干节点检查超时与取消
+     */
+    bool _shouldStop();
+
+    /**
+     * @brief 置换表项：该局面在 depth 步内的最高估值
+     */
+    struct Entry {
+        int depth;
+        int value;
+    };
+
+    const BlockerMasks& _blockers;
+    HintOptions _options;
+    const std::atomic<bool>* _cancel;
+    std::chrono::steady_clock::time_point _deadline;
+
+    long long _nodes = 0;
+    bool _aborted = false;
+    bool _hitDepthLimit = false;    ///< 本层是否有分支因深度不足而截断 (否则已搜完整棵树)
+    std::unordered_map<CompactGameState, Entry, CompactGameStateHash> _table;
+};
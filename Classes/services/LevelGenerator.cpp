@@ -0,0 +1,201 @@
+#include "LevelGenerator.h"
+#include "GameRuleService.h"
+#include "models/CompactGameState.h"
+#include <algorithm>
+#include <cmath>
+
+USING_NS_CC;
+
+namespace {
+    // 布局常量：与 GameView 的设计分辨率及 GameRuleService 的遮挡阈值 (100 x 120) 对应
+    const float kDesignWidth = 1080.0f;     ///< 设计分辨率宽度
+    const float kCardWidth = 180.0f;        ///< CardView 显示宽度
+    const float kTopRowY = 1150.0f;         ///< 山顶所在行的 y 坐标 (playfield 层内)
+    const float kRowSpacing = 100.0f;       ///< 行距：< 120 保证相邻行遮挡，>= 60 保证隔行不遮挡
+    const float kMaxColumnSpacing = 120.0f; ///< 列距上限
+    const float kMinColumnSpacing = 68.0f;  ///< 列距下限：1.5 倍列距需 >= 100，避免压住斜下方第二张
+
+    const float kEasyDrawChance = 0.30f;    ///< 难度 0 时每步倒推插入抽牌的概率
+    const float kHardDrawChance = 0.08f;    ///< 难度 1 时每步倒推插入抽牌的概率
+    const int kEasySpareCards = 6;          ///< 难度 0 时额外的备用牌张数
+
+    const uint64_t kFullDeckMask = (1ULL << CompactGameState::kMaxCards) - 1;
+
+    // 从掩码中均匀随机取一张牌，掩码为空返回 -1
+    int pickFromMask(uint64_t mask, std::mt19937_64& rng) {
+        int count = CompactGameState::countOf(mask);
+        if (count == 0) return -1;
+
+        int skip = (int)(rng() % (uint64_t)count);
+        for (; skip > 0; --skip) mask &= mask - 1;
+        return CompactGameState::lowestOf(mask);
+    }
+
+    CardConfigData toCardConfig(int cardId) {
+        CardConfigData card;
+        card.cardFace = CompactGameState::faceOf(cardId);
+        card.cardSuit = CompactGameState::suitOf(cardId);
+        card.x = 0.0f;
+        card.y = 0.0f;
+        card.zOrder = 0;
+        card.isFaceUp = false;
+        card.deck = 0;
+        return card;
+    }
+}
+
+LevelLayout LevelGenerator::buildLayout(int peakCount, int peakRows) {
+    LevelLayout layout;
+    if (peakCount < 1 || peakRows < 2) return layout;
+
+    // 1. 底行张数决定列距，底行需完整放进屏幕宽度
+    int span = peakRows - 1;
+    int bottomCount = peakCount * span + 1;
+    float spacing = std::min(kMaxColumnSpacing, (kDesignWidth - kCardWidth) / (bottomCount - 1));
+    spacing = std::floor(spacing / 2.0f) * 2.0f;    // 取偶数，半个列距仍为整数坐标
+    if (spacing < kMinColumnSpacing) {
+        CCLOG("Error: Layout too wide: %d peaks x %d rows", peakCount, peakRows);
+        return layout;
+    }
+    float left = kDesignWidth / 2.0f - spacing * (bottomCount - 1) / 2.0f;
+
+    // 2. 山峰各行：第 r 行每峰 r+1 张，相对底行右移 (span - r) 个半列距
+    for (int row = 0; row < span; ++row) {
+        for (int peak = 0; peak < peakCount; ++peak) {
+            for (int k = 0; k <= row; ++k) {
+                float column = peak * span + k + (span - row) * 0.5f;
+                layout.positions.push_back(Vec2(left + column * spacing, kTopRowY - row * kRowSpacing));
+                layout.rows.push_back(row);
+            }
+        }
+    }
+
+    // 3. 共享底行
+    for (int k = 0; k < bottomCount; ++k) {
+        layout.positions.push_back(Vec2(left + k * spacing, kTopRowY - span * kRowSpacing));
+        layout.rows.push_back(span);
+    }
+
+    // 4. 遮挡图直接用规则服务计算，保证与运行时判定一致
+    std::vector<CardConfigData> cards(layout.positions.size());
+    for (size_t i = 0; i < cards.size(); ++i) {
+        cards[i].x = layout.positions[i].x;
+        cards[i].y = layout.positions[i].y;
+    }
+    layout.coverGraph = GameRuleService::buildCoverGraph(cards);
+    return layout;
+}
+
+GeneratedLevel LevelGenerator::generate(const LevelLayout& layout, const GeneratorOptions& options, std::mt19937_64& rng) {
+    GeneratedLevel level;
+    if (!layout.isValid() || (int)layout.positions.size() >= CompactGameState::kMaxCards) return level;
+
+    for (int attempt = 0; attempt < options.maxAttempts; ++attempt) {
+        if (_tryGenerate(layout, options, rng, level)) {
+            level.success = true;
+            break;
+        }
+    }
+    return level;
+}
+
+GeneratedLevel LevelGenerator::generate(const GeneratorOptions& options, uint64_t seed) {
+    std::mt19937_64 rng(seed);
+    return generate(buildLayout(options.peakCount, options.peakRows), options, rng);
+}
+
+bool LevelGenerator::_tryGenerate(const LevelLayout& layout, const GeneratorOptions& options,
+    std::mt19937_64& rng, GeneratedLevel& out) {
+    const CoverGraph& graph = layout.coverGraph;
+    int positionCount = (int)layout.positions.size();
+    float difficulty = std::max(0.0f, std::min(1.0f, options.difficulty));
+    float drawChance = kEasyDrawChance + (kHardDrawChance - kEasyDrawChance) * difficulty;
+    std::uniform_real_distribution<float> coin(0.0f, 1.0f);
+
+    // 1. 倒推可放回的位置：一个位置压住的牌全部放回后它才能放回 (正向即它先于被压牌消除)
+    std::vector<int> pendingCovered(positionCount);
+    std::vector<int> fillable;
+    for (int p = 0; p < positionCount; ++p) {
+        pendingCovered[p] = (int)graph.getCoveredNodes(p).size();
+        if (pendingCovered[p] == 0) fillable.push_back(p);
+    }
+
+    std::vector<int> placed(positionCount, -1);
+    std::vector<int> reversedStock;
+    std::vector<SolverMove> reversedMoves;
+    uint64_t used = 0;
+    int filled = 0;
+
+    // 2. 终局：桌面已清空，底牌堆顶为任意一张牌
+    int top = pickFromMask(kFullDeckMask, rng);
+    used |= CompactGameState::bit(top);
+
+    while (filled < positionCount) {
+        // 可作为“下一张底牌”的相邻点数 (仍有未用花色)
+        int face = CompactGameState::faceOf(top);
+        uint64_t neighbors = 0;
+        if (face > 1) neighbors |= CompactGameState::faceMask(face - 1);
+        if (face < 13) neighbors |= CompactGameState::faceMask(face + 1);
+        neighbors &= ~used;
+
+        bool click = neighbors != 0 && coin(rng) >= drawChance;
+        if (click) {
+            // 撤销一次点击：底牌放回桌面，其下一张底牌与之相邻
+            int slot = (int)(rng() % (uint64_t)fillable.size());
+            int position = fillable[slot];
+            fillable[slot] = fillable.back();
+            fillable.pop_back();
+
+            placed[position] = top;
+            filled++;
+            for (int blocker : graph.getBlockers(position)) {
+                if (--pendingCovered[blocker] == 0) fillable.push_back(blocker);
+            }
+            reversedMoves.push_back({ false, top });
+            top = pickFromMask(neighbors, rng);
+        }
+        else {
+            // 撤销一次抽牌：底牌放回备用牌堆顶，其下一张底牌任意
+            reversedStock.push_back(top);
+            reversedMoves.push_back({ true, top });
+            top = pickFromMask(kFullDeckMask & ~used, rng);
+            if (top < 0) return false;
+        }
+        used |= CompactGameState::bit(top);
+    }
+
+    // 3. 组装配置：drawStackCards[0] 为初始底牌，其余为正向抽牌顺序
+    LevelConfig& config = out.config;
+    config.levelId = options.levelId;
+    config.playfieldCards.clear();
+    config.drawStackCards.clear();
+
+    for (int p = 0; p < positionCount; ++p) {
+        CardConfigData card = toCardConfig(placed[p]);
+        card.x = layout.positions[p].x;
+        card.y = layout.positions[p].y;
+        card.zOrder = layout.rows[p];
+        card.isFaceUp = graph.getBlockers(p).empty();
+        config.playfieldCards.push_back(card);
+    }
+    config.coverGraph = graph;
+
+    config.drawStackCards.push_back(toCardConfig(top));
+    for (auto it = reversedStock.rbegin(); it != reversedStock.rend(); ++it) {
+        config.drawStackCards.push_back(toCardConfig(*it));
+    }
+
+    // 4. 低难度额外追加解法用不到的备用牌，给玩家留出试错空间
+    int spare = (int)std::lround(kEasySpareCards * (1.0f - difficulty));
+    out.spareCards = 0;
+    for (; out.spareCards < spare; ++out.spareCards) {
+        int cardId = pickFromMask(kFullDeckMask & ~used, rng);
+        if (cardId < 0) break;
+        used |= CompactGameState::bit(cardId);
+        config.drawStackCards.push_back(toCardConfig(cardId));
+    }
+
+    out.solution.assign(reversedMoves.rbegin(), reversedMoves.rend());
+    out.planDraws = (int)reversedStock.size();
+    return true;
+}
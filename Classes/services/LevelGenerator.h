@@ -0,0 +1,85 @@
+#pragma once
+#include "configs/LevelConfig.h"
+#include "services/LevelSolver.h"
+#include <cstdint>
+#include <random>
+#include <vector>
+
+/**
+ * @struct GeneratorOptions
+ * @brief 关卡生成参数
+ */
+struct GeneratorOptions {
+    int levelId = 0;            ///< 写入配置的关卡 ID
+    int peakCount = 3;          ///< 山峰数量
+    int peakRows = 4;           ///< 每座山峰的行数 (含底部公共行)
+    float difficulty = 0.5f;    ///< 目标难度 [0, 1]：越大连击越长、备用牌越少
+    int maxAttempts = 16;       ///< 单关最多重试次数 (牌型用尽时重发)
+};
+
+/**
+ * @struct LevelLayout
+ * @brief 金字塔 (TriPeaks) 桌面布局
+ * 同一组参数下的布局与遮挡图固定不变，批量生成时只需构建一次。
+ */
+struct LevelLayout {
+    std::vector<cocos2d::Vec2> positions;   ///< 每个桌面位置的坐标 (playfield 层内)
+    std::vector<int> rows;                  ///< 每个位置所在行 (0 为山顶，同时作为 zOrder)
+    CoverGraph coverGraph;                  ///< 位置之间的遮挡关系
+
+    bool isValid() const { return !positions.empty(); }
+};
+
+/**
+ * @struct GeneratedLevel
+ * @brief 生成结果
+ */
+struct GeneratedLevel {
+    bool success = false;               ///< 是否生成成功
+    LevelConfig config;                 ///< 可直接写出/加载的关卡配置
+    std::vector<SolverMove> solution;   ///< 生成时构造的一条必胜解
+    int planDraws = 0;                  ///< 必胜解中的抽牌次数
+    int spareCards = 0;                 ///< 解法之外的备用牌张数
+};
+
+/**
+ * @class LevelGenerator
+ * @brief 可解关卡的程序化生成器
+ * @responsibility 构建 TriPeaks 布局 (坐标满足 GameRuleService 的遮挡阈值)，
+ *                 再从“桌面已清空”的终局倒推发牌：每一步要么把底牌放回一个可放回的桌面位置
+ *                 (其下一张底牌必须与之相邻)，要么把它放回备用牌堆顶。
+ *                 倒推过程就是一条正向必胜解，因此生成的关卡必然可解。
+ * @usage 纯数据运算，不依赖 GameModel / View，可在工具或后台线程中批量调用：
+ *        LevelLayout layout = LevelGenerator::buildLayout(3, 4);
+ *        GeneratedLevel level = LevelGenerator::generate(layout, options, rng);
+ */
+class LevelGenerator {
+public:
+    /**
+     * @brief 构建 TriPeaks 布局
+     * 山峰第 r 行每峰 r+1 张，最底行为所有山峰共享的一整行；
+     * 相邻两行左右错开半个间距，使每张牌恰好被下一行的两张压住。
+     * @param peakCount 山峰数量 (>= 1)
+     * @param peakRows 每座山峰的行数 (>= 2)
+     * @return LevelLayout 布局，参数超出屏幕范围时返回空布局
+     */
+    static LevelLayout buildLayout(int peakCount, int peakRows);
+
+    /**
+     * @brief 在给定布局上生成一个必定可解的关卡
+     * @param layout 由 buildLayout 构建的布局
+     * @param options 生成参数
+     * @param rng 随机数发生器 (相同种子结果可复现)
+     * @return GeneratedLevel 生成结果，重试次数用尽时 success 为 false
+     */
+    static GeneratedLevel generate(const LevelLayout& layout, const GeneratorOptions& options, std::mt19937_64& rng);
+
+    /**
+     * @brief 便捷接口：按参数构建布局并生成
+     */
+    static GeneratedLevel generate(const GeneratorOptions& options, uint64_t seed);
+
+private:
+    static bool _tryGenerate(const LevelLayout& layout, const GeneratorOptions& options,
+        std::mt19937_64& rng, GeneratedLevel& out);
+};
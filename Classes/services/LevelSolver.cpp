@@ -0,0 +1,94 @@
+#include "LevelSolver.h"
+#include "GameModelGenerator.h"
+#include "GameRuleService.h"
+
+USING_NS_CC;
+
+SolveResult LevelSolver::solve(const LevelConfig& config, const SolveOptions& options) {
+    if (!config.isValid()) return SolveResult();
+
+    // 与 GameController::startGame 保持一致：生成数据后先计算一次遮挡关系
+    auto model = GameModel::create();
+    GameModelGenerator::generate(model, config);
+    GameRuleService::updateFaceUpStates(model);
+
+    CompactGameState start;
+    if (!CompactGameState::fromModel(model, start)) {
+        SolveResult result;
+        result.aborted = true;
+        result.unsupported = true;
+        return result;
+    }
+
+    BlockerMasks blockers = GameRuleService::buildBlockerMasks(model);
+    return solve(start, blockers, options);
+}
+
+SolveResult LevelSolver::solve(const CompactGameState& start, const BlockerMasks& blockers,
+    const SolveOptions& options) {
+    LevelSolver solver(blockers, options);
+    solver._search(start, 0);
+    return solver._result;
+}
+
+LevelSolver::LevelSolver(const BlockerMasks& blockers, const SolveOptions& options)
+    : _blockers(blockers), _options(options)
+{
+}
+
+void LevelSolver::_search(const CompactGameState& state, int draws) {
+    if (_result.aborted) return;
+    if (++_result.nodes > _options.maxNodes) {
+        _result.aborted = true;
+        return;
+    }
+
+    // 1. 胜利：记录更优解
+    if (state.playfieldMask == 0) {
+        if (!_result.solvable || draws < _result.minDraws) {
+            _result.solvable = true;
+            _result.minDraws = draws;
+            _result.solution = _line;
+        }
+        return;
+    }
+
+    // 2. 剪枝：已有解且当前抽牌数不可能更优
+    if (_result.solvable && (!_options.findMinimumDraws || draws >= _result.minDraws)) return;
+
+    // 3. 置换表去重 (抽牌进度是局面的一部分，同一局面的抽牌数必然相同)
+    if (!_transposition.insert(state).second) {
+        _result.transpositionHits++;
+        return;
+    }
+
+    uint64_t clickable = state.playfieldMask & state.faceUpMask & GameRuleService::getMatchMask(state.topCardId);
+    bool canDraw = state.drawCount > 0;
+    if (!clickable && !canDraw) {
+        _result.deadEnds++;
+        return;
+    }
+
+    // 4. 优先尝试消除桌面牌 (不增加抽牌数)，最后再抽牌
+    for (uint64_t rest = clickable; rest; rest &= rest - 1) {
+        int cardId = CompactGameState::lowestOf(rest);
+
+        CompactGameState next = state;
+        next.moveToDiscard(cardId);
+        GameRuleService::updateFaceUpStates(next, _blockers);
+
+        _line.push_back({ false, cardId });
+        _search(next, draws);
+        _line.pop_back();
+        if (_result.aborted) return;
+    }
+
+    if (canDraw) {
+        CompactGameState next = state;
+        int cardId = next.drawNextCard();
+
+        _line.push_back({ true, cardId });
+        _search(next, draws + 1);
+        _line.pop_back();
+    }
+}
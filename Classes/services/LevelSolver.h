@@ -0,0 +1,79 @@
+#pragma once
+#include "models/CompactGameState.h"
+#include "configs/LevelConfig.h"
+#include <cstdint>
+#include <unordered_set>
+#include <vector>
+
+/**
+ * @struct SolveOptions
+ * @brief 求解器搜索参数
+ */
+struct SolveOptions {
+    bool findMinimumDraws = true;   ///< true: 分支限界求最少抽牌数；false: 找到任意解即停止
+    long long maxNodes = 2000000;   ///< 搜索节点上限，超出视为中止 (结果不确定)
+};
+
+/**
+ * @struct SolverMove
+ * @brief 解法中的一步操作
+ */
+struct SolverMove {
+    bool isDraw;    ///< true 为点击备用牌堆，false 为点击桌面牌
+    int cardId;     ///< 本步移入底牌堆的卡牌 ID
+};
+
+/**
+ * @struct SolveResult
+ * @brief 求解结果统计
+ */
+struct SolveResult {
+    bool solvable = false;              ///< 是否存在必胜解
+    bool aborted = false;               ///< 是否因节点上限中止或局面不受支持 (此时 solvable=false 不可信)
+    bool unsupported = false;           ///< 局面无法用 CompactGameState 表示 (如多副牌关卡)，未进行搜索
+    int minDraws = -1;                  ///< 最优解所需抽牌次数，无解为 -1
+    long long nodes = 0;                ///< 展开的搜索节点数
+    long long transpositionHits = 0;    ///< 置换表命中 (去重) 次数
+    long long deadEnds = 0;             ///< 无路可走的叶子局面数，可作为难度参考
+    std::vector<SolverMove> solution;   ///< 找到的 (最优) 解法
+};
+
+/**
+ * @class LevelSolver
+ * @brief 无界面关卡求解器
+ * @responsibility 按 GameModelGenerator 的方式构建初始局面，基于 GameRuleService 规则
+ *                 对“点击桌面牌/抽牌”两类操作做深度优先搜索，使用置换表去重。
+ * @usage 关卡发布前的批量校验工具，静态调用 solve 即可，不依赖任何 View。
+ *        搜索在 CompactGameState 上进行，每个节点只拷贝一个 88 字节的局面。
+ */
+class LevelSolver {
+public:
+    /**
+     * @brief 求解一个关卡配置
+     * @param config 关卡配置 (通常来自 LevelConfigLoader::loadLevel)
+     * @param options 搜索参数
+     * @return SolveResult 求解结果
+     */
+    static SolveResult solve(const LevelConfig& config, const SolveOptions& options = SolveOptions());
+
+    /**
+     * @brief 从任意局面开始求解 (如对局中途)
+     * @param start 起始局面，翻面状态需已是最新
+     * @param blockers 该关卡的静态遮挡表
+     * @param options 搜索参数
+     */
+    static SolveResult solve(const CompactGameState& start, const BlockerMasks& blockers,
+        const SolveOptions& options = SolveOptions());
+
+private:
+    LevelSolver(const BlockerMasks& blockers, const SolveOptions& options);
+
+    void _search(const CompactGameState& state, int draws);
+
+    const BlockerMasks& _blockers;
+    SolveOptions _options;
+    SolveResult _result;
+
+    std::unordered_set<CompactGameState, CompactGameStateHash> _transposition;  ///< 已展开的局面
+    std::vector<SolverMove> _line;                                              ///< 当前搜索路径
+};
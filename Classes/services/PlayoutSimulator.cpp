@@ -0,0 +1,130 @@
+#include "PlayoutSimulator.h"
+#include "GameRuleService.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    const double kZ95 = 1.959964;  ///< 95% 置信度对应的正态分位数
+}
+
+void PlayoutStats::merge(const PlayoutStats& other) {
+    playouts += other.playouts;
+    wins += other.wins;
+    remainingSum += other.remainingSum;
+    remainingSqSum += other.remainingSqSum;
+}
+
+double PlayoutStats::getWinRate() const {
+    return playouts > 0 ? (double)wins / playouts : 0.0;
+}
+
+void PlayoutStats::getWinRateInterval(double& low, double& high) const {
+    if (playouts == 0) {
+        low = 0.0;
+        high = 1.0;
+        return;
+    }
+
+    double n = (double)playouts;
+    double p = getWinRate();
+    double z2 = kZ95 * kZ95;
+    double denom = 1.0 + z2 / n;
+    double center = (p + z2 / (2.0 * n)) / denom;
+    double half = kZ95 * std::sqrt(p * (1.0 - p) / n + z2 / (4.0 * n * n)) / denom;
+    low = std::max(0.0, center - half);
+    high = std::min(1.0, center + half);
+}
+
+double PlayoutStats::getAverageRemaining() const {
+    return playouts > 0 ? (double)remainingSum / playouts : 0.0;
+}
+
+double PlayoutStats::getRemainingMargin() const {
+    if (playouts < 2) return 0.0;
+
+    double n = (double)playouts;
+    double variance = ((double)remainingSqSum - (double)remainingSum * remainingSum / n) / (n - 1.0);
+    return kZ95 * std::sqrt(std::max(0.0, variance) / n);
+}
+
+int PlayoutSimulator::_countUncovered(const CompactGameState& state, const BlockerMasks& blockers, int cardId) {
+    uint64_t before = state.playfieldMask;
+    uint64_t after = before & ~CompactGameState::bit(cardId);
+
+    int count = 0;
+    for (uint64_t rest = after & ~state.faceUpMask; rest; rest &= rest - 1) {
+        int id = CompactGameState::lowestOf(rest);
+        if ((blockers[id] & after) == 0) count++;
+    }
+    return count;
+}
+
+bool PlayoutSimulator::playOnce(const CompactGameState& start, const BlockerMasks& blockers,
+    double epsilon, std::mt19937_64& rng, int& outRemaining) {
+    std::uniform_real_distribution<double> coin(0.0, 1.0);
+    CompactGameState state = start;
+
+    while (true) {
+        if (state.playfieldMask == 0) {
+            outRemaining = 0;
+            return true;
+        }
+
+        uint64_t clickable = state.playfieldMask & state.faceUpMask & GameRuleService::getMatchMask(state.topCardId);
+        bool canDraw = state.drawCount > 0;
+        if (!clickable && !canDraw) {
+            outRemaining = state.getPlayfieldCardCount();
+            return false;
+        }
+
+        int chosen = -1;
+        if (epsilon > 0.0 && coin(rng) < epsilon) {
+            // 探索：在所有合法操作中均匀随机 (最后一个选项为抽牌)
+            int options = CompactGameState::countOf(clickable) + (canDraw ? 1 : 0);
+            int pick = (int)(rng() % (uint64_t)options);
+            for (uint64_t rest = clickable; rest && pick >= 0; rest &= rest - 1, --pick) {
+                if (pick == 0) chosen = CompactGameState::lowestOf(rest);
+            }
+        }
+        else if (clickable) {
+            // 贪心：优先翻开最多的牌，并列时随机
+            int bestScore = -1;
+            int ties = 0;
+            for (uint64_t rest = clickable; rest; rest &= rest - 1) {
+                int id = CompactGameState::lowestOf(rest);
+                int score = _countUncovered(state, blockers, id);
+                if (score > bestScore) {
+                    bestScore = score;
+                    chosen = id;
+                    ties = 1;
+                }
+                else if (score == bestScore && rng() % (uint64_t)(++ties) == 0) {
+                    chosen = id;
+                }
+            }
+        }
+
+        if (chosen >= 0) {
+            state.moveToDiscard(chosen);
+            GameRuleService::updateFaceUpStates(state, blockers);
+        }
+        else {
+            state.drawNextCard();
+        }
+    }
+}
+
+PlayoutStats PlayoutSimulator::run(const CompactGameState& start, const BlockerMasks& blockers,
+    int playouts, double epsilon, uint64_t seed) {
+    PlayoutStats stats;
+    std::mt19937_64 rng(seed);
+
+    for (int i = 0; i < playouts; ++i) {
+        int remaining = 0;
+        if (playOnce(start, blockers, epsilon, rng, remaining)) stats.wins++;
+        stats.playouts++;
+        stats.remainingSum += remaining;
+        stats.remainingSqSum += (long long)remaining * remaining;
+    }
+    return stats;
+}
@@ -0,0 +1,70 @@
+#pragma once
+#include "models/CompactGameState.h"
+#include <cstdint>
+#include <random>
+
+/**
+ * @struct PlayoutStats
+ * @brief 随机对局的累计统计
+ * 只保存可累加的计数，便于多个线程分块模拟后合并。
+ */
+struct PlayoutStats {
+    long long playouts = 0;         ///< 对局数
+    long long wins = 0;             ///< 胜局数
+    long long remainingSum = 0;     ///< 结束时桌面剩余牌数之和
+    long long remainingSqSum = 0;   ///< 剩余牌数平方和 (用于方差)
+
+    /**
+     * @brief 合并另一批统计
+     */
+    void merge(const PlayoutStats& other);
+
+    double getWinRate() const;
+
+    /**
+     * @brief 胜率的 95% Wilson 置信区间
+     */
+    void getWinRateInterval(double& low, double& high) const;
+
+    double getAverageRemaining() const;
+
+    /**
+     * @brief 平均剩余牌数的 95% 置信区间半宽
+     */
+    double getRemainingMargin() const;
+};
+
+/**
+ * @class PlayoutSimulator
+ * @brief 随机对局模拟器 (蒙特卡洛难度估计)
+ * @responsibility 在 CompactGameState 上按 epsilon-greedy 策略模拟整局游戏，统计胜率与剩余牌数。
+ * @usage 纯值类型运算、无共享状态，可在多个工作线程中并行调用；
+ *        初始局面与遮挡表需在主线程通过 GameModelGenerator / GameRuleService 预先构建。
+ */
+class PlayoutSimulator {
+public:
+    /**
+     * @brief 模拟一局
+     * 策略：有可点击的桌面牌时优先点击“能翻开最多牌”的那张；以 epsilon 的概率改为随机探索
+     *       (在所有合法操作中随机选择，包括抽牌)。
+     * @param start 初始局面
+     * @param blockers 静态遮挡表
+     * @param epsilon 探索概率 [0, 1]
+     * @param rng 随机数发生器
+     * @param outRemaining 结束时桌面剩余牌数
+     * @return bool 是否获胜
+     */
+    static bool playOnce(const CompactGameState& start, const BlockerMasks& blockers,
+        double epsilon, std::mt19937_64& rng, int& outRemaining);
+
+    /**
+     * @brief 连续模拟多局
+     * @param seed 随机种子 (相同种子结果可复现，与线程数无关)
+     */
+    static PlayoutStats run(const CompactGameState& start, const BlockerMasks& blockers,
+        int playouts, double epsilon, uint64_t seed);
+
+private:
+    // 统计点击某张牌后会被翻开的牌数 (贪心估值)
+    static int _countUncovered(const CompactGameState& state, const BlockerMasks& blockers, int cardId);
+};
@@ -0,0 +1,78 @@
+#include "ReplayVerifier.h"
+#include "GameModelGenerator.h"
+#include "GameRuleService.h"
+#include "managers/UndoManager.h"
+
+USING_NS_CC;
+
+namespace {
+    ReplayResult fail(ReplayResult& result, int opIndex, const char* error) {
+        result.valid = false;
+        result.failedOp = opIndex;
+        result.error = error;
+        return result;
+    }
+}
+
+ReplayResult ReplayVerifier::verify(const LevelConfig& config, const ReplayLog& log) {
+    ReplayResult result;
+    if (!config.isValid()) return fail(result, -1, "invalid level config");
+    if (config.levelId != log.getLevelId()) return fail(result, -1, "level id mismatch");
+
+    // 1. 与 GameController::startGame 相同的初始化流程，但不创建任何 View
+    auto model = GameModel::create();
+    GameModelGenerator::generate(model, config);
+    GameRuleService::updateFaceUpStates(model);
+
+    UndoManager undoManager;
+    undoManager.reset(model);
+
+    // 2. 逐条回放
+    bool gameOver = false;
+    size_t offset = 0;
+    ReplayLog::Op op;
+    for (int index = 0; index < log.getOpCount(); ++index) {
+        if (!log.readOp(offset, op)) return fail(result, index, "corrupted op");
+        if (gameOver) return fail(result, index, "op after game over");
+
+        int topId = model->getTopCardId();
+        switch (op.type) {
+        case ReplayLog::OpType::Click: {
+            auto card = model->getCardById(op.cardId);
+            auto topCard = model->getCardById(topId);
+            if (!card || !topCard) return fail(result, index, "unknown card");
+            if (card->getState() != CardState::Playfield) return fail(result, index, "card not on playfield");
+            if (!card->isFaceUp()) return fail(result, index, "card is covered");
+            if (!GameRuleService::canMatch(card, topCard)) return fail(result, index, "card does not match");
+
+            undoManager.execute(MoveRecord::makeMove(op.cardId, topId, CardState::Playfield));
+            break;
+        }
+        case ReplayLog::OpType::Draw: {
+            int count = 0;
+            const int* next = model->peekNextDrawCards(1, count);
+            if (count == 0) return fail(result, index, "draw stack is empty");
+
+            undoManager.execute(MoveRecord::makeDraw(next[0], topId));
+            break;
+        }
+        case ReplayLog::OpType::Undo:
+            if (!undoManager.undo()) return fail(result, index, "nothing to undo");
+            break;
+        case ReplayLog::OpType::Redo:
+            if (!undoManager.redo()) return fail(result, index, "nothing to redo");
+            break;
+        }
+        result.appliedOps++;
+
+        // 与 GameController::checkGameState 一致：胜利或无路可走后界面不再接受操作
+        result.remainingCards = model->getPlayfieldCardCount();
+        gameOver = result.remainingCards == 0
+            || (model->getDrawStackSize() == 0 && !GameRuleService::hasAnyMove(model));
+    }
+
+    result.valid = true;
+    result.remainingCards = model->getPlayfieldCardCount();
+    result.won = result.remainingCards == 0;
+    return result;
+}
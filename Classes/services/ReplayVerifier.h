@@ -0,0 +1,36 @@
+#pragma once
+#include "configs/LevelConfig.h"
+#include "models/ReplayLog.h"
+#include <string>
+
+/**
+ * @struct ReplayResult
+ * @brief 回放校验结果
+ */
+struct ReplayResult {
+    bool valid = false;         ///< 所有操作都合法
+    bool won = false;           ///< 回放结束时桌面已清空
+    int appliedOps = 0;         ///< 成功回放的操作数
+    int failedOp = -1;          ///< 第一个非法操作的序号 (合法时为 -1)
+    int remainingCards = 0;     ///< 回放结束时桌面剩余牌数
+    std::string error;          ///< 非法原因
+};
+
+/**
+ * @class ReplayVerifier
+ * @brief 无界面回放校验器
+ * @responsibility 按 GameModelGenerator 构建初始牌局，在 GameModel 上逐条回放 ReplayLog，
+ *                 用 GameRuleService 校验每次点击，撤销/重做走与游戏相同的 UndoManager 历史，
+ *                 对局结束 (胜利或无路可走) 后的任何操作都视为非法。
+ * @usage 服务端排行榜校验：ReplayVerifier::verify(config, log).won 为 true 才接受成绩。
+ */
+class ReplayVerifier {
+public:
+    /**
+     * @brief 回放并校验
+     * @param config 日志对应关卡的配置 (levelId 必须一致)
+     * @param log 客户端上传的操作日志
+     * @return ReplayResult 校验结果
+     */
+    static ReplayResult verify(const LevelConfig& config, const ReplayLog& log);
+};
@@ -0,0 +1,123 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @class ByteWriter
+ * @brief 小端序二进制写入器
+ * @responsibility 向字节缓冲追加定长整数与变长整数 (LEB128)，与平台字节序无关。
+ * @usage 存档、回放日志等紧凑二进制格式的序列化。
+ */
+class ByteWriter {
+public:
+    explicit ByteWriter(std::vector<uint8_t>& buffer) : _buffer(buffer) {}
+
+    void writeU8(uint8_t value) { _buffer.push_back(value); }
+
+    void writeU16(uint16_t value) {
+        writeU8((uint8_t)value);
+        writeU8((uint8_t)(value >> 8));
+    }
+
+    void writeU32(uint32_t value) {
+        for (int i = 0; i < 4; ++i) writeU8((uint8_t)(value >> (i * 8)));
+    }
+
+    void writeU64(uint64_t value) {
+        for (int i = 0; i < 8; ++i) writeU8((uint8_t)(value >> (i * 8)));
+    }
+
+    /**
+     * @brief 变长无符号整数：每字节 7 位，小于 128 的值只占 1 字节
+     */
+    void writeVarint(uint64_t value) {
+        while (value >= 0x80) {
+            writeU8((uint8_t)(value | 0x80));
+            value >>= 7;
+        }
+        writeU8((uint8_t)value);
+    }
+
+    void writeBytes(const void* data, size_t size) {
+        const uint8_t* bytes = (const uint8_t*)data;
+        _buffer.insert(_buffer.end(), bytes, bytes + size);
+    }
+
+    size_t size() const { return _buffer.size(); }
+
+private:
+    std::vector<uint8_t>& _buffer;
+};
+
+/**
+ * @class ByteReader
+ * @brief 小端序二进制读取器
+ * @responsibility 按 ByteWriter 的格式读取数据；越界时置失败标志并返回 0，不抛异常。
+ * @usage 连续读取后统一检查 isOk()，避免每次读取都判断。
+ */
+class ByteReader {
+public:
+    ByteReader(const uint8_t* data, size_t size) : _data(data), _size(size) {}
+
+    uint8_t readU8() {
+        if (_pos >= _size) {
+            _ok = false;
+            return 0;
+        }
+        return _data[_pos++];
+    }
+
+    uint16_t readU16() {
+        uint16_t low = readU8();
+        return (uint16_t)(low | ((uint16_t)readU8() << 8));
+    }
+
+    uint32_t readU32() {
+        uint32_t value = 0;
+        for (int i = 0; i < 4; ++i) value |= (uint32_t)readU8() << (i * 8);
+        return value;
+    }
+
+    uint64_t readU64() {
+        uint64_t value = 0;
+        for (int i = 0; i < 8; ++i) value |= (uint64_t)readU8() << (i * 8);
+        return value;
+    }
+
+    uint64_t readVarint() {
+        uint64_t value = 0;
+        for (int shift = 0; shift < 64; shift += 7) {
+            uint8_t byte = readU8();
+            value |= (uint64_t)(byte & 0x7F) << shift;
+            if (!(byte & 0x80)) return value;
+        }
+        _ok = false;
+        return 0;
+    }
+
+    /**
+     * @brief 取出一段原始字节 (零拷贝，返回指向源数据的指针)
+     */
+    const uint8_t* readBytes(size_t size) {
+        if (size > _size - _pos) {
+            _ok = false;
+            _pos = _size;
+            return nullptr;
+        }
+        const uint8_t* bytes = _data + _pos;
+        _pos += size;
+        return bytes;
+    }
+
+    bool isOk() const { return _ok; }
+    bool atEnd() const { return _pos >= _size; }
+    size_t position() const { return _pos; }
+    size_t remaining() const { return _size - _pos; }
+
+private:
+    const uint8_t* _data;
+    size_t _size;
+    size_t _pos = 0;
+    bool _ok = true;
+};
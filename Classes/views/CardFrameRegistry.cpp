@@ -0,0 +1,144 @@
+#include "CardFrameRegistry.h"
+
+USING_NS_CC;
+
+std::array<SpriteFrame*, 52> CardFrameRegistry::_faceFrames = {};
+SpriteFrame* CardFrameRegistry::_backFrame = nullptr;
+Texture2D* CardFrameRegistry::_atlasTexture = nullptr;
+CardResConfig::CardSize CardFrameRegistry::_size = CardResConfig::CardSize::Large;
+
+namespace {
+    // 按 (花色, 点数) 顺序解析 52 个牌面 + 牌背，任一缺失即失败
+    template <typename T, typename Resolve>
+    bool resolveAll(std::array<T, 53>& out, Resolve resolve) {
+        for (int suit = 0; suit < 4; ++suit) {
+            for (int face = 1; face <= 13; ++face) {
+                out[suit * 13 + face - 1] = resolve(CardResConfig::getCardFrameName((CardSuit)suit, (CardFace)face));
+                if (!out[suit * 13 + face - 1]) return false;
+            }
+        }
+        out[52] = resolve(CardResConfig::getBackFrameName());
+        return (bool)out[52];
+    }
+}
+
+CardResConfig::CardSize CardFrameRegistry::selectSize(float contentScaleFactor) {
+    // 与 AppDelegate 中三档分辨率的缩放因子对应：约 1.0 / 2.1 / 4.3
+    if (contentScaleFactor >= 4.0f) return CardResConfig::CardSize::Large;
+    if (contentScaleFactor >= 2.0f) return CardResConfig::CardSize::Medium;
+    return CardResConfig::CardSize::Small;
+}
+
+bool CardFrameRegistry::load(float contentScaleFactor) {
+    unload();
+
+    // 1. 所选尺寸的图集不可用时依次尝试更大的尺寸 (small 套图没有牌背)
+    for (int size = (int)selectSize(contentScaleFactor); size <= (int)CardResConfig::CardSize::Large; ++size) {
+        if (_loadAtlas((CardResConfig::CardSize)size)) return true;
+    }
+
+    // 2. 图集全部缺失：逐张加载 large 图片
+    CCLOG("CardFrameRegistry: card atlas unavailable, falling back to individual images");
+    return _loadImages(CardResConfig::CardSize::Large);
+}
+
+void CardFrameRegistry::loadAsync(float contentScaleFactor, const std::function<void(bool)>& onLoaded) {
+    if (isLoaded()) {
+        if (onLoaded) onLoaded(true);
+        return;
+    }
+
+    for (int size = (int)selectSize(contentScaleFactor); size <= (int)CardResConfig::CardSize::Large; ++size) {
+        auto cardSize = (CardResConfig::CardSize)size;
+        if (!_isAtlasComplete(cardSize)) continue;
+
+        Director::getInstance()->getTextureCache()->addImageAsync(CardResConfig::getAtlasTexturePath(cardSize),
+            [contentScaleFactor, cardSize, onLoaded](Texture2D* texture) {
+                // 等待期间可能已被同步加载 (如直接恢复存档)
+                bool ok = isLoaded() || (texture && _loadAtlas(cardSize)) || load(contentScaleFactor);
+                if (onLoaded) onLoaded(ok);
+            });
+        return;
+    }
+
+    bool ok = load(contentScaleFactor);
+    if (onLoaded) onLoaded(ok);
+}
+
+bool CardFrameRegistry::_isAtlasComplete(CardResConfig::CardSize size) {
+    std::string plist = CardResConfig::getAtlasPlistPath(size);
+    if (!FileUtils::getInstance()->isFileExist(plist)) return false;
+
+    ValueMap dict = FileUtils::getInstance()->getValueMapFromFile(plist);
+    auto framesIt = dict.find("frames");
+    if (framesIt == dict.end() || framesIt->second.getType() != Value::Type::MAP) return false;
+
+    const ValueMap& frames = framesIt->second.asValueMap();
+    std::array<bool, 53> found = {};
+    return resolveAll(found, [&frames](const std::string& name) {
+        return frames.count(name) > 0;
+    });
+}
+
+void CardFrameRegistry::unload() {
+    for (auto& frame : _faceFrames) {
+        CC_SAFE_RELEASE_NULL(frame);
+    }
+    CC_SAFE_RELEASE_NULL(_backFrame);
+    CC_SAFE_RELEASE_NULL(_atlasTexture);
+}
+
+bool CardFrameRegistry::_loadAtlas(CardResConfig::CardSize size) {
+    std::string plist = CardResConfig::getAtlasPlistPath(size);
+    if (!FileUtils::getInstance()->isFileExist(plist)) return false;
+
+    // 借助 SpriteFrameCache 解析 plist，取出句柄后立即移除：
+    // 三套图集的帧名相同，全局缓存中只能存在一套，句柄由本类持有
+    auto cache = SpriteFrameCache::getInstance();
+    cache->addSpriteFramesWithFile(plist);
+
+    std::array<SpriteFrame*, 53> frames = {};
+    bool complete = resolveAll(frames, [cache](const std::string& name) {
+        return cache->getSpriteFrameByName(name);
+    });
+
+    if (complete) {
+        for (auto frame : frames) frame->retain();
+    }
+    cache->removeSpriteFramesFromFile(plist);
+
+    if (!complete) {
+        CCLOG("CardFrameRegistry: atlas %s is incomplete", plist.c_str());
+        return false;
+    }
+
+    std::copy(frames.begin(), frames.begin() + 52, _faceFrames.begin());
+    _backFrame = frames[52];
+    _atlasTexture = _backFrame->getTexture();
+    CC_SAFE_RETAIN(_atlasTexture);
+    _size = size;
+    return true;
+}
+
+bool CardFrameRegistry::_loadImages(CardResConfig::CardSize size) {
+    auto textureCache = Director::getInstance()->getTextureCache();
+    std::string directory = CardResConfig::getImageDirectory(size);
+
+    std::array<SpriteFrame*, 53> frames = {};
+    bool complete = resolveAll(frames, [&](const std::string& name) -> SpriteFrame* {
+        auto texture = textureCache->addImage(directory + name);
+        if (!texture) return nullptr;
+        return SpriteFrame::createWithTexture(texture, Rect(Vec2::ZERO, texture->getContentSize()));
+    });
+
+    if (!complete) {
+        CCLOG("CardFrameRegistry: missing card images in %s", directory.c_str());
+        return false;
+    }
+
+    for (auto frame : frames) frame->retain();
+    std::copy(frames.begin(), frames.begin() + 52, _faceFrames.begin());
+    _backFrame = frames[52];
+    _size = size;
+    return true;
+}
@@ -0,0 +1,84 @@
+#pragma once
+#include "cocos2d.h"
+#include "configs/CardResConfig.h"
+#include "models/GameConstants.h"
+#include <array>
+#include <functional>
+
+/**
+ * @class CardFrameRegistry
+ * @brief 卡牌纹理句柄表
+ * @responsibility 启动时按内容缩放因子选择一套卡牌资源 (small/medium/large)，一次性解析 52 张牌面与牌背的
+ *                 SpriteFrame 并持有引用；之后的视图刷新只需按 (花色, 点数) 下标取指针，无字符串拼接与哈希查找。
+ * @usage AppDelegate 设置好 ContentScaleFactor 后调用 load()；CardView 等通过 getFaceFrame / getBackFrame 取句柄。
+ *        只能在主线程使用。
+ */
+class CardFrameRegistry {
+public:
+    /**
+     * @brief 解析并缓存全部卡牌帧
+     * 优先加载所选尺寸的图集；图集缺失或不完整时依次尝试更大的尺寸，都失败则回退为逐张加载 large 图片。
+     * 重复调用会先释放之前的句柄。
+     * @param contentScaleFactor Director 的内容缩放因子
+     * @return bool 是否成功解析全部 53 个帧
+     */
+    static bool load(float contentScaleFactor);
+
+    /**
+     * @brief 异步加载：图集纹理在 TextureCache 的工作线程中解码，完成后在主线程解析帧
+     * 已加载时立即回调。找不到完整图集时退化为同步 load()。
+     * @param contentScaleFactor Director 的内容缩放因子
+     * @param onLoaded 主线程回调，参数为是否成功
+     */
+    static void loadAsync(float contentScaleFactor, const std::function<void(bool)>& onLoaded);
+
+    /**
+     * @brief 释放全部句柄
+     */
+    static void unload();
+
+    static bool isLoaded() { return _backFrame != nullptr; }
+
+    /**
+     * @brief 根据内容缩放因子选择资源尺寸
+     */
+    static CardResConfig::CardSize selectSize(float contentScaleFactor);
+
+    /**
+     * @brief 当前使用的资源尺寸
+     */
+    static CardResConfig::CardSize getSize() { return _size; }
+
+    /**
+     * @brief 获取牌面帧
+     * @return cocos2d::SpriteFrame* 花色/点数非法或未加载时返回 nullptr
+     */
+    static cocos2d::SpriteFrame* getFaceFrame(CardSuit suit, CardFace face) {
+        int suitIndex = (int)suit;
+        int faceIndex = (int)face - 1;
+        if (suitIndex < 0 || suitIndex >= 4 || faceIndex < 0 || faceIndex >= 13) return nullptr;
+        return _faceFrames[suitIndex * 13 + faceIndex];
+    }
+
+    static cocos2d::SpriteFrame* getBackFrame() { return _backFrame; }
+
+    /**
+     * @brief 图集纹理 (逐张加载的回退模式下返回 nullptr)
+     */
+    static cocos2d::Texture2D* getAtlasTexture() { return _atlasTexture; }
+
+private:
+    // 只读取 plist 检查是否包含全部 53 个帧，不加载纹理
+    static bool _isAtlasComplete(CardResConfig::CardSize size);
+
+    // 从图集解析全部帧，不完整时不修改已有句柄
+    static bool _loadAtlas(CardResConfig::CardSize size);
+
+    // 逐张加载图片并包装为整张纹理的帧
+    static bool _loadImages(CardResConfig::CardSize size);
+
+    static std::array<cocos2d::SpriteFrame*, 52> _faceFrames;  ///< 下标 = 花色 * 13 + 点数 - 1
+    static cocos2d::SpriteFrame* _backFrame;
+    static cocos2d::Texture2D* _atlasTexture;
+    static CardResConfig::CardSize _size;
+};
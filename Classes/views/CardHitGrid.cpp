@@ -0,0 +1,71 @@
+#include "CardHitGrid.h"
+#include <algorithm>
+
+USING_NS_CC;
+
+void CardHitGrid::reset(const Rect& area, float cellSize) {
+    _origin = area.origin;
+    _cellSize = std::max(cellSize, 1.0f);
+    _cols = std::max(1, (int)std::ceil(area.size.width / _cellSize));
+    _rows = std::max(1, (int)std::ceil(area.size.height / _cellSize));
+
+    _cells.assign((size_t)_cols * _rows, std::vector<int>());
+    _entries.clear();
+}
+
+int CardHitGrid::_colOf(float x) const {
+    int col = (int)std::floor((x - _origin.x) / _cellSize);
+    return std::min(std::max(col, 0), _cols - 1);
+}
+
+int CardHitGrid::_rowOf(float y) const {
+    int row = (int)std::floor((y - _origin.y) / _cellSize);
+    return std::min(std::max(row, 0), _rows - 1);
+}
+
+void CardHitGrid::insert(int cardId, const Rect& bounds, unsigned order) {
+    if (cardId < 0 || _cells.empty()) return;
+
+    remove(cardId);
+    if (cardId >= (int)_entries.size()) {
+        _entries.resize(cardId + 1);
+    }
+
+    Entry& entry = _entries[cardId];
+    entry.minCol = _colOf(bounds.getMinX());
+    entry.maxCol = _colOf(bounds.getMaxX());
+    entry.minRow = _rowOf(bounds.getMinY());
+    entry.maxRow = _rowOf(bounds.getMaxY());
+    entry.order = order;
+
+    for (int row = entry.minRow; row <= entry.maxRow; ++row) {
+        for (int col = entry.minCol; col <= entry.maxCol; ++col) {
+            _cells[(size_t)row * _cols + col].push_back(cardId);
+        }
+    }
+}
+
+void CardHitGrid::remove(int cardId) {
+    if (cardId < 0 || cardId >= (int)_entries.size()) return;
+
+    Entry& entry = _entries[cardId];
+    for (int row = entry.minRow; row <= entry.maxRow; ++row) {
+        for (int col = entry.minCol; col <= entry.maxCol; ++col) {
+            auto& cell = _cells[(size_t)row * _cols + col];
+            auto it = std::find(cell.begin(), cell.end(), cardId);
+            if (it != cell.end()) {
+                // 单元内顺序无意义，与末尾交换后删除
+                *it = cell.back();
+                cell.pop_back();
+            }
+        }
+    }
+    entry = Entry();
+}
+
+const std::vector<int>& CardHitGrid::query(const Vec2& point) const {
+    static const std::vector<int> kEmpty;
+    if (_cells.empty()) return kEmpty;
+
+    return _cells[(size_t)_rowOf(point.y) * _cols + _colOf(point.x)];
+}
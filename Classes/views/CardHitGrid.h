@@ -0,0 +1,66 @@
+#pragma once
+#include "cocos2d.h"
+#include <vector>
+
+/**
+ * @class CardHitGrid
+ * @brief 卡牌点击检测用的均匀网格
+ * @responsibility 把每张卡牌的包围盒登记到它覆盖的网格单元中，点击时只取触点所在单元的候选卡牌，
+ *                 查询代价与桌面上的卡牌总数无关。只负责几何索引，层级判定由 GameView 完成。
+ * @usage GameView 持有；卡牌静止落位时 insert，开始飞行或移除时 remove。坐标统一使用主牌区图层的本地坐标。
+ */
+class CardHitGrid {
+public:
+    /**
+     * @brief 清空并重新划分网格
+     * @param area 网格覆盖的区域，超出区域的包围盒会被钳制到边缘单元
+     * @param cellSize 单元边长 (取与卡牌尺寸同量级，使每张牌只落在少数几个单元中)
+     */
+    void reset(const cocos2d::Rect& area, float cellSize);
+
+    /**
+     * @brief 登记 (或更新) 卡牌的包围盒
+     * @param order 插入序号，层级相同时序号大的在上层
+     */
+    void insert(int cardId, const cocos2d::Rect& bounds, unsigned order);
+
+    /**
+     * @brief 注销卡牌
+     */
+    void remove(int cardId);
+
+    /**
+     * @brief 获取触点所在单元的候选卡牌 ID
+     * 候选只保证包围盒与该单元相交，调用方仍需精确判定是否包含触点。
+     */
+    const std::vector<int>& query(const cocos2d::Vec2& point) const;
+
+    /**
+     * @brief 卡牌的插入序号 (未登记返回 0)
+     */
+    unsigned getOrder(int cardId) const {
+        return cardId >= 0 && cardId < (int)_entries.size() ? _entries[cardId].order : 0;
+    }
+
+private:
+    /**
+     * @brief 卡牌在网格中覆盖的单元范围
+     */
+    struct Entry {
+        int minCol = 0;
+        int minRow = 0;
+        int maxCol = -1;    ///< maxCol < minCol 表示未登记
+        int maxRow = -1;
+        unsigned order = 0;
+    };
+
+    int _colOf(float x) const;
+    int _rowOf(float y) const;
+
+    cocos2d::Vec2 _origin;
+    float _cellSize = 1.0f;
+    int _cols = 0;
+    int _rows = 0;
+    std::vector<std::vector<int>> _cells;   ///< 行优先，每个单元内为卡牌 ID 列表
+    std::vector<Entry> _entries;            ///< 按卡牌 ID 索引
+};
@@ -0,0 +1,149 @@
+#include "CardTweenSystem.h"
+#include <algorithm>
+
+USING_NS_CC;
+
+namespace {
+    const float kScalePulse = 0.1f;         ///< 飞行途中的最大放大比例
+    const float kScalePeakTime = 1.0f / 3;  ///< 放大到峰值的时间点 (归一化)
+}
+
+CardTweenSystem::CardTweenSystem(int initialCapacity) {
+    _cardIds.reserve(initialCapacity);
+    _nodes.reserve(initialCapacity);
+    _from.reserve(initialCapacity);
+    _to.reserve(initialCapacity);
+    _baseScales.reserve(initialCapacity);
+    _elapsed.reserve(initialCapacity);
+    _durations.reserve(initialCapacity);
+    _endZOrders.reserve(initialCapacity);
+    _easings.reserve(initialCapacity);
+    _flags.reserve(initialCapacity);
+    _completed.reserve(initialCapacity);
+}
+
+void CardTweenSystem::start(int cardId, Node* node, const Vec2& target, float duration,
+    int zOrderOnComplete, uint8_t flags, Easing easing) {
+    if (cardId < 0 || !node) return;
+
+    if (cardId >= (int)_slotOfCard.size()) {
+        _slotOfCard.resize(cardId + 1, -1);
+    }
+
+    int slot = _slotOfCard[cardId];
+    if (slot >= 0) {
+        // 改道：从当前位置出发，缩放基准沿用最初的值
+        _from[slot] = node->getPosition();
+        _to[slot] = target;
+        _elapsed[slot] = 0.0f;
+        _durations[slot] = duration;
+        _endZOrders[slot] = zOrderOnComplete;
+        _easings[slot] = (uint8_t)easing;
+        _flags[slot] = flags;
+        return;
+    }
+
+    _slotOfCard[cardId] = (int)_cardIds.size();
+    _cardIds.push_back(cardId);
+    _nodes.push_back(node);
+    _from.push_back(node->getPosition());
+    _to.push_back(target);
+    _baseScales.push_back(node->getScale());
+    _elapsed.push_back(0.0f);
+    _durations.push_back(duration);
+    _endZOrders.push_back(zOrderOnComplete);
+    _easings.push_back((uint8_t)easing);
+    _flags.push_back(flags);
+}
+
+void CardTweenSystem::cancel(int cardId) {
+    if (!isAnimating(cardId)) return;
+
+    int slot = _slotOfCard[cardId];
+    _nodes[slot]->setScale(_baseScales[slot]);
+    _removeSlot(slot);
+}
+
+void CardTweenSystem::cancelAll() {
+    for (int slot = 0; slot < (int)_cardIds.size(); ++slot) {
+        _nodes[slot]->setScale(_baseScales[slot]);
+        _slotOfCard[_cardIds[slot]] = -1;
+    }
+
+    _cardIds.clear();
+    _nodes.clear();
+    _from.clear();
+    _to.clear();
+    _baseScales.clear();
+    _elapsed.clear();
+    _durations.clear();
+    _endZOrders.clear();
+    _easings.clear();
+    _flags.clear();
+}
+
+void CardTweenSystem::_removeSlot(int slot) {
+    int last = (int)_cardIds.size() - 1;
+    _slotOfCard[_cardIds[slot]] = -1;
+
+    if (slot != last) {
+        _cardIds[slot] = _cardIds[last];
+        _nodes[slot] = _nodes[last];
+        _from[slot] = _from[last];
+        _to[slot] = _to[last];
+        _baseScales[slot] = _baseScales[last];
+        _elapsed[slot] = _elapsed[last];
+        _durations[slot] = _durations[last];
+        _endZOrders[slot] = _endZOrders[last];
+        _easings[slot] = _easings[last];
+        _flags[slot] = _flags[last];
+        _slotOfCard[_cardIds[slot]] = slot;
+    }
+
+    _cardIds.pop_back();
+    _nodes.pop_back();
+    _from.pop_back();
+    _to.pop_back();
+    _baseScales.pop_back();
+    _elapsed.pop_back();
+    _durations.pop_back();
+    _endZOrders.pop_back();
+    _easings.pop_back();
+    _flags.pop_back();
+}
+
+float CardTweenSystem::_ease(Easing easing, float t) {
+    switch (easing) {
+    case Easing::QuadOut:
+        return t * (2.0f - t);
+    case Easing::QuadInOut:
+        return t < 0.5f ? 2.0f * t * t : -1.0f + (4.0f - 2.0f * t) * t;
+    default:
+        return t;
+    }
+}
+
+const std::vector<CardTweenSystem::Completion>& CardTweenSystem::update(float dt) {
+    _completed.clear();
+
+    // 倒序遍历，完成的补间与末尾交换删除时不会跳过未处理的槽位
+    for (int slot = (int)_cardIds.size() - 1; slot >= 0; --slot) {
+        float duration = _durations[slot];
+        float elapsed = _elapsed[slot] + dt;
+        _elapsed[slot] = elapsed;
+
+        float t = duration > 0.0f ? std::min(elapsed / duration, 1.0f) : 1.0f;
+        float k = _ease((Easing)_easings[slot], t);
+        float pulse = t < kScalePeakTime ? t / kScalePeakTime : (1.0f - t) / (1.0f - kScalePeakTime);
+
+        Node* node = _nodes[slot];
+        node->setPosition(_from[slot] + (_to[slot] - _from[slot]) * k);
+        node->setScale(_baseScales[slot] * (1.0f + kScalePulse * pulse));
+
+        if (t >= 1.0f) {
+            _completed.push_back({ _cardIds[slot], node, _endZOrders[slot], _flags[slot] });
+            _removeSlot(slot);
+        }
+    }
+    return _completed;
+}
@@ -0,0 +1,106 @@
+#pragma once
+#include "cocos2d.h"
+#include <climits>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @class CardTweenSystem
+ * @brief 卡牌补间动画池
+ * @responsibility 以结构数组 (SoA) 保存所有进行中的卡牌移动补间，每帧在一次 update 中统一推进位置与缩放，
+ *                 结束的补间批量返回给调用方处理。启动补间只写入预分配的数组，不创建 Action / CallFunc，
+ *                 也不经过 ActionManager。
+ * @usage GameView 持有并在自身的 update 中驱动；完成后的层级、显隐等收尾以数据形式随补间提交，无需回调。
+ */
+class CardTweenSystem {
+public:
+    /**
+     * @brief 缓动曲线
+     */
+    enum class Easing : uint8_t {
+        Linear = 0,
+        QuadOut = 1,    ///< 先快后慢
+        QuadInOut = 2   ///< 两端慢中间快
+    };
+
+    /**
+     * @brief 补间结束时的附加动作 (可按位组合)
+     */
+    enum CompleteFlags : uint8_t {
+        None = 0,
+        RefreshView = 1 << 0,   ///< 按 Model 刷新正反面
+        Hide = 1 << 1           ///< 隐藏节点 (如飞回备用牌堆)
+    };
+
+    static const int kKeepZOrder = INT_MIN;    ///< 完成时不修改层级
+
+    /**
+     * @brief 结束的补间 (批量返回)
+     */
+    struct Completion {
+        int cardId;
+        cocos2d::Node* node;
+        int zOrder;         ///< 完成时应用的层级，kKeepZOrder 表示不变
+        uint8_t flags;      ///< CompleteFlags
+    };
+
+    explicit CardTweenSystem(int initialCapacity = 64);
+
+    /**
+     * @brief 启动一段移动补间
+     * 同一张牌已有进行中的补间时，从当前位置改为飞向新目标。
+     * 位移按 easing 插值，同时缩放先放大 10% 再还原 (前 1/3 时长放大，后 2/3 还原)。
+     * @param cardId 卡牌 ID (完成标识)
+     * @param node 卡牌节点 (由调用方保证在补间期间有效，移除前需 cancel)
+     * @param target 目标位置 (父节点坐标)
+     * @param duration 时长 (秒)
+     * @param zOrderOnComplete 完成时应用的层级
+     * @param flags 完成时的附加动作
+     */
+    void start(int cardId, cocos2d::Node* node, const cocos2d::Vec2& target, float duration,
+        int zOrderOnComplete = kKeepZOrder, uint8_t flags = None, Easing easing = Easing::Linear);
+
+    /**
+     * @brief 取消某张牌的补间 (节点停在当前位置，缩放还原)
+     */
+    void cancel(int cardId);
+
+    /**
+     * @brief 取消全部补间
+     */
+    void cancelAll();
+
+    bool isAnimating(int cardId) const {
+        return cardId >= 0 && cardId < (int)_slotOfCard.size() && _slotOfCard[cardId] >= 0;
+    }
+
+    int getActiveCount() const { return (int)_cardIds.size(); }
+
+    /**
+     * @brief 推进全部补间
+     * @param dt 帧间隔 (秒)
+     * @return 本帧结束的补间，在下一次 update 前有效
+     */
+    const std::vector<Completion>& update(float dt);
+
+private:
+    // 移除指定槽位 (与末尾交换)
+    void _removeSlot(int slot);
+
+    static float _ease(Easing easing, float t);
+
+    // --- 结构数组：同一下标对应同一个补间 ---
+    std::vector<int> _cardIds;
+    std::vector<cocos2d::Node*> _nodes;
+    std::vector<cocos2d::Vec2> _from;
+    std::vector<cocos2d::Vec2> _to;
+    std::vector<float> _baseScales;
+    std::vector<float> _elapsed;
+    std::vector<float> _durations;
+    std::vector<int> _endZOrders;
+    std::vector<uint8_t> _easings;
+    std::vector<uint8_t> _flags;
+
+    std::vector<int> _slotOfCard;           ///< 卡牌 ID -> 槽位，-1 表示无补间
+    std::vector<Completion> _completed;     ///< 本帧完成列表 (复用内存)
+};
@@ -1,5 +1,5 @@
 #include "CardView.h"
-#include "configs/CardResConfig.h"
+#include "CardFrameRegistry.h"
 
 USING_NS_CC;
 
@@ -17,66 +17,53 @@ bool CardView::init(const CardModel* model) {
     if (!Sprite::init()) return false;
 
     _modelRef = model;
-    _cardId = model->getId();
+    _cardId = model ? model->getId() : -1;
 
-    // ˢ
+    // 立即刷新外观
     this->updateView();
 
-    // 󶨴
-    auto listener = EventListenerTouchOneByOne::create();
-    listener->setSwallowTouches(true);
-    listener->onTouchBegan = CC_CALLBACK_2(CardView::onTouchBegan, this);
-    listener->onTouchEnded = CC_CALLBACK_2(CardView::onTouchEnded, this);
-    _eventDispatcher->addEventListenerWithSceneGraphPriority(listener, this);
-
     return true;
 }
 
+void CardView::bindModel(const CardModel* model) {
+    _modelRef = model;
+    _cardId = model ? model->getId() : -1;
+
+    this->stopAllActions();
+    this->setPosition(Vec2::ZERO);
+    this->setLocalZOrder(0);
+    this->setRotation(0.0f);
+    this->setOpacity(255);
+    this->setColor(Color3B::WHITE);
+    this->setVisible(true);
+
+    // 帧未变化时 updateView 不会重设缩放，这里显式还原
+    this->updateView();
+    this->setScale(_baseScale);
+}
+
 void CardView::updateView() {
     if (!_modelRef) return;
 
-    std::string imgPath;
-    if (_modelRef->isFaceUp()) {
-        imgPath = CardResConfig::getCardImagePath(_modelRef->getSuit(), _modelRef->getFace());
-    }
-    else {
-        imgPath = CardResConfig::getBackImagePath();
+    // 句柄在启动时已解析，这里只是指针比较与交换
+    if (!CardFrameRegistry::isLoaded()) {
+        CardFrameRegistry::load(Director::getInstance()->getContentScaleFactor());
     }
+    auto frame = _modelRef->isFaceUp()
+        ? CardFrameRegistry::getFaceFrame(_modelRef->getSuit(), _modelRef->getFace())
+        : CardFrameRegistry::getBackFrame();
+    if (!frame || frame == _spriteFrame) return;
 
-    this->setTexture(imgPath);
+    this->setSpriteFrame(frame);
 
-    // ̬ţ׼Ϊ 180px
+    // 动态计算缩放：假设标准宽度为 180px
     if (this->getContentSize().width > 0) {
         _baseScale = 180.0f / this->getContentSize().width;
         this->setScale(_baseScale);
     }
 }
 
-void CardView::setOnClickCallback(const std::function<void(int)>& callback) {
-    _onClickCallback = callback;
-}
-
-bool CardView::onTouchBegan(Touch* touch, Event* event) {
-    Vec2 locationInNode = this->convertToNodeSpace(touch->getLocation());
-    Size s = this->getContentSize();
-    Rect rect = Rect(0, 0, s.width, s.height);
-
-    if (rect.containsPoint(locationInNode)) {
-        // ΢С
-        this->setScale(_baseScale * 0.95f);
-        return true;
-    }
-    return false;
-}
-
-void CardView::onTouchEnded(Touch* touch, Event* event) {
-    // ָ
-    this->setScale(_baseScale);
-
-    // ߼
-    // ע⣺߼ֻҪ˲ɿʹɿʱָǷƳ˿
-    // Ҫϸжٴμ rect.containsPoint
-    if (_onClickCallback) {
-        _onClickCallback(_cardId);
-    }
+void CardView::setPressed(bool pressed) {
+    // 点击反馈：按下时轻微缩小
+    this->setScale(pressed ? _baseScale * 0.95f : _baseScale);
 }
\ No newline at end of file
@@ -1,48 +1,48 @@
 #pragma once
 #include "cocos2d.h"
 #include "models/CardModel.h"
-#include <functional>
 
 /**
  * @class CardView
- * @brief ſƵͼڵ
- * @responsibility ʾƵ/棩Ӧ¼ Controller
- * @usage  GameView ͹
+ * @brief 单张卡牌的视图节点
+ * @responsibility 负责显示卡牌的纹理（正面/背面）及按下反馈。
+ * @usage 由 GameView 创建和管理；触摸由 GameView 统一判定，卡牌本身不注册监听器。
  */
 class CardView : public cocos2d::Sprite {
 public:
     /**
-     * @brief ̬
-     * @param model ģֻͣ
+     * @brief 静态工厂方法
+     * @param model 卡牌数据模型（只读），可为 nullptr (对象池预创建，稍后 bindModel)
      */
     static CardView* create(const CardModel* model);
 
     /**
-     * @brief  Model ˢʾ
-     * ŵȡ
+     * @brief 重新绑定数据模型并复位显示状态
+     * 供 CardViewPool 复用实例：清除上一局残留的位置、层级、缩放、显隐与动作。
+     */
+    void bindModel(const CardModel* model);
+
+    /**
+     * @brief 根据 Model 数据刷新显示
+     * 更新正反面纹理、缩放等。
      */
     void updateView();
 
     /**
-     * @brief õص
-     * @param callback տIDĻص
+     * @brief 按下/松开时的缩放反馈
+     * @param pressed true 为按下 (轻微缩小)，false 为恢复
      */
-    void setOnClickCallback(const std::function<void(int cardId)>& callback);
+    void setPressed(bool pressed);
 
     int getCardId() const { return _cardId; }
 
 private:
     bool init(const CardModel* model);
 
-    // ¼ص
-    bool onTouchBegan(cocos2d::Touch* touch, cocos2d::Event* event);
-    void onTouchEnded(cocos2d::Touch* touch, cocos2d::Event* event);
-
-    int _cardId;            ///<  ID 
+    int _cardId;            ///< 卡牌 ID 缓存
 
-    // [MVC] View  Model ָֻ
+    // [MVC修正] View 持有 Model 的只读指针
     const CardModel* _modelRef;
 
-    std::function<void(int)> _onClickCallback;
-    float _baseScale = 1.0f; ///< ĻĻ׼ֵ
+    float _baseScale = 1.0f; ///< 基于屏幕适配的基准缩放值
 };
\ No newline at end of file
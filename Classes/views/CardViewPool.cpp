@@ -0,0 +1,52 @@
+#include "CardViewPool.h"
+
+USING_NS_CC;
+
+std::vector<CardView*> CardViewPool::_free;
+
+void CardViewPool::prewarm(int count) {
+    if (count > kMaxFree) count = kMaxFree;
+    _free.reserve(count);
+
+    while ((int)_free.size() < count) {
+        auto cardView = CardView::create(nullptr);
+        if (!cardView) break;
+        cardView->retain();
+        _free.push_back(cardView);
+    }
+}
+
+CardView* CardViewPool::acquire(const CardModel* model) {
+    if (_free.empty()) {
+        return CardView::create(model);
+    }
+
+    // 池中持有的引用转交给自动释放池，调用方 addChild 后由父节点持有
+    CardView* cardView = _free.back();
+    _free.pop_back();
+    cardView->bindModel(model);
+    cardView->autorelease();
+    return cardView;
+}
+
+void CardViewPool::release(CardView* cardView) {
+    if (!cardView) return;
+
+    if ((int)_free.size() >= kMaxFree) {
+        cardView->removeFromParent();
+        return;
+    }
+
+    // 先持有再移除，避免父节点释放后引用计数归零
+    cardView->retain();
+    cardView->removeFromParent();
+    cardView->bindModel(nullptr);
+    _free.push_back(cardView);
+}
+
+void CardViewPool::purge() {
+    for (auto cardView : _free) {
+        cardView->release();
+    }
+    _free.clear();
+}
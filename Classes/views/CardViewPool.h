@@ -0,0 +1,44 @@
+#pragma once
+#include "CardView.h"
+#include <vector>
+
+/**
+ * @class CardViewPool
+ * @brief 进程级 CardView 对象池
+ * @responsibility 持有空闲 CardView 的引用，重开关卡或切换场景时复用已初始化的精灵，
+ *                 避免每局重新创建 52 个节点。
+ * @usage 启动时 prewarm；GameController::_initCardViews 通过 acquire 取用，GameView::clearBoard 与析构时 release 归还。
+ *        只能在主线程使用。
+ */
+class CardViewPool {
+public:
+    /**
+     * @brief 预创建若干实例 (不绑定 Model)
+     * @param count 池中空闲实例的目标数量
+     */
+    static void prewarm(int count);
+
+    /**
+     * @brief 取出一个实例并绑定 Model
+     * 池为空时新建。返回的实例已 autorelease，由添加到的父节点持有。
+     */
+    static CardView* acquire(const CardModel* model);
+
+    /**
+     * @brief 归还实例：从父节点移除并解除 Model 绑定
+     * 超过容量上限的实例直接释放。
+     */
+    static void release(CardView* cardView);
+
+    /**
+     * @brief 释放全部空闲实例
+     */
+    static void purge();
+
+    static int getFreeCount() { return (int)_free.size(); }
+
+private:
+    static const int kMaxFree = 512;    ///< 空闲实例上限 (多副牌关卡结束后不无限占用内存)
+
+    static std::vector<CardView*> _free;    ///< 空闲实例 (各持有一次引用)
+};
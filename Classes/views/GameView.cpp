@@ -1,7 +1,14 @@
 #include "GameView.h"
+#include "CardViewPool.h"
 
 USING_NS_CC;
 
+namespace {
+    const float kHitCellSize = 180.0f;  ///< 点击网格单元边长
+    const float kMoveDuration = 0.3f;   ///< 卡牌移动动画时长
+    const int kHintActionTag = 0x4854;  ///< 提示高亮动作的标签 (重复提示时替换)
+}
+
 Scene* GameView::createScene() {
     auto scene = Scene::create();
     auto layer = GameView::create();
@@ -9,102 +16,233 @@ Scene* GameView::createScene() {
     return scene;
 }
 
+GameView::~GameView() {
+    // 场景销毁时同样归还卡牌视图 (图层仍由本节点持有，可以安全移除子节点)
+    _tweens.cancelAll();
+    for (auto cardView : _cardViewsById) {
+        CardViewPool::release(cardView);
+    }
+}
+
 bool GameView::init() {
     if (!Layer::init()) return false;
 
-    // 1. 
-    auto bg = LayerColor::create(Color4B(50, 100, 50, 255)); // ɫ
+    // 1. 背景
+    auto bg = LayerColor::create(Color4B(50, 100, 50, 255)); // 深绿色背景
     this->addChild(bg, -1);
 
-    // 2. 򻮷
-    //  (Playfield): Ϸ (0, 580)
+    // 2. 区域划分
+    // 主牌区 (Playfield): 放在上方 (0, 580)
     _playfieldLayer = Node::create();
     _playfieldLayer->setPosition(Vec2(0, 580));
     this->addChild(_playfieldLayer, 1);
 
-    //  (Stack): ڵײ (0, 0)
+    // 堆牌区 (Stack): 放在底部 (0, 0)
     _stackLayer = Node::create();
     _stackLayer->setPosition(Vec2(0, 0));
     this->addChild(_stackLayer, 1);
 
+    // 3. 棋盘触摸：整个棋盘只注册这一个监听器，监听器数量与卡牌数量无关
+    // 网格覆盖整个视图 (换算到主牌区图层坐标)，单元边长与卡牌显示尺寸 (180) 相当
+    _hitGrid.reset(Rect(-_playfieldLayer->getPosition(), this->getContentSize()), kHitCellSize);
+
+    auto listener = EventListenerTouchOneByOne::create();
+    listener->setSwallowTouches(true);
+    listener->onTouchBegan = CC_CALLBACK_2(GameView::_onBoardTouchBegan, this);
+    listener->onTouchEnded = CC_CALLBACK_2(GameView::_onBoardTouchEnded, this);
+    listener->onTouchCancelled = CC_CALLBACK_2(GameView::_onBoardTouchCancelled, this);
+    _eventDispatcher->addEventListenerWithSceneGraphPriority(listener, this);
+
+    // 4. 卡牌补间由本视图的 update 统一推进
+    this->scheduleUpdate();
+
     return true;
 }
 
 void GameView::addCardToLayer(CardView* cardView, const Vec2& pos, int zOrder) {
     if (!cardView) return;
 
-    // ֹظӵ±
+    // 防止重复添加导致报错
     if (cardView->getParent()) {
         cardView->removeFromParent();
     }
 
-    // λúͲ㼶
+    // 设置位置和层级
     cardView->setPosition(pos);
     cardView->setLocalZOrder(zOrder);
 
-    // ԭʼ߼Ĭӵ PlayfieldLayer
-    // ע⣺ζŴ pos  PlayfieldLayer 
+    // 保持您的原始逻辑：默认添加到 PlayfieldLayer
+    // 注意：这意味着传入的 pos 必须是相对于 PlayfieldLayer 的坐标
     _playfieldLayer->addChild(cardView);
-}
 
-CardView* GameView::getCardViewById(int cardId) {
-    // 1. 
-    for (auto node : _playfieldLayer->getChildren()) {
-        auto card = dynamic_cast<CardView*>(node);
-        if (card && card->getCardId() == cardId) return card;
+    // 登记到 ID 索引表，查找时无需遍历子节点
+    int cardId = cardView->getCardId();
+    if (cardId >= (int)_cardViewsById.size()) {
+        _cardViewsById.resize(cardId + 1, nullptr);
     }
+    _cardViewsById[cardId] = cardView;
 
-    // 2. [ȫ] 
-    // ȻĿǰ addCardToLayer ֻӵ Playfieldȫ߼Էֹδչʱı
-    if (_stackLayer) {
-        for (auto node : _stackLayer->getChildren()) {
-            auto card = dynamic_cast<CardView*>(node);
-            if (card && card->getCardId() == cardId) return card;
-        }
-    }
+    _registerHitBounds(cardView);
+}
 
-    return nullptr;
+CardView* GameView::getCardViewById(int cardId) {
+    if (cardId < 0 || cardId >= (int)_cardViewsById.size()) return nullptr;
+    return _cardViewsById[cardId];
 }
 
-void GameView::playMoveCardAnim(int cardId, const Vec2& targetPos, const std::function<void()>& onComplete) {
+void GameView::removeCardView(int cardId) {
     auto cardView = getCardViewById(cardId);
     if (!cardView) return;
 
-    // 1. ȡǰֵ
-    float originalScale = cardView->getScale();
+    _cardViewsById[cardId] = nullptr;
+    _tweens.cancel(cardId);
+    _hitGrid.remove(cardId);
+    if (_pressedCardId == cardId) _pressedCardId = -1;
+    CardViewPool::release(cardView);
+}
 
-    // Ȩ֤ϲ
-    cardView->setLocalZOrder(100);
+void GameView::playMoveCardAnim(int cardId, const Vec2& targetPos, int zOrderOnComplete, uint8_t completeFlags) {
+    auto cardView = getCardViewById(cardId);
+    if (!cardView) return;
 
-    // 2. 
-    auto moveTo = MoveTo::create(0.3f, targetPos);
+    // 提权：保证动画过程中在最上层
+    cardView->setLocalZOrder(100);
 
-    // Ч΢Ŵԭ
-    auto scaleUp = ScaleTo::create(0.1f, originalScale * 1.1f);
-    auto scaleDown = ScaleTo::create(0.2f, originalScale);
-    auto scaleSeq = Sequence::create(scaleUp, scaleDown, nullptr);
+    // 飞行中的卡牌不参与点击判定，落位后按新位置重新登记
+    _hitGrid.remove(cardId);
 
-    auto anim = Spawn::create(moveTo, scaleSeq, nullptr);
+    // 位移 0.3 秒；缩放微弱放大后还原
+    _tweens.start(cardId, cardView, targetPos, kMoveDuration, zOrderOnComplete, completeFlags);
+}
 
-    auto callback = CallFunc::create([cardView, onComplete, targetPos]() {
-        // λ
-        cardView->setPosition(targetPos);
+void GameView::update(float dt) {
+    Layer::update(dt);
 
-        // [ؼ] ɾ cardView->setLocalZOrder(5);
-        // ԭ򣺲㼶Ӧ Command  onComplete ִкͨ Model ݻ߼
-        // ǿΪ 5Ḳ Command ȷ㼶 10ڵ
+    // 同一帧落位的卡牌一起收尾
+    for (const auto& done : _tweens.update(dt)) {
+        CardView* cardView = static_cast<CardView*>(done.node);
 
-        if (onComplete) onComplete();
-        });
+        // 层级由 Command 按 Model 计算后随动画提交 (例如底牌堆叠层级)
+        if (done.zOrder != CardTweenSystem::kKeepZOrder) cardView->setLocalZOrder(done.zOrder);
+        if (done.flags & CardTweenSystem::RefreshView) cardView->updateView();
+        if (done.flags & CardTweenSystem::Hide) cardView->setVisible(false);
 
-    cardView->runAction(Sequence::create(anim, callback, nullptr));
+        _registerHitBounds(cardView);
+    }
 }
 
 void GameView::clearBoard() {
+    _tweens.cancelAll();
+
+    // 卡牌视图归还对象池，下一局直接复用
+    for (auto cardView : _cardViewsById) {
+        CardViewPool::release(cardView);
+    }
+    _cardViewsById.clear();
+    _hitGrid.reset(Rect(-_playfieldLayer->getPosition(), this->getContentSize()), kHitCellSize);
+    _pressedCardId = -1;
     if (_playfieldLayer) {
         _playfieldLayer->removeAllChildren();
     }
     if (_stackLayer) {
         _stackLayer->removeAllChildren();
     }
-}
\ No newline at end of file
+}
+
+void GameView::setOnCardClickCallback(const std::function<void(int)>& callback) {
+    _onCardClick = callback;
+}
+
+void GameView::setDrawPile(Node* drawPile, const std::function<void()>& callback) {
+    if (_drawPile && _drawPile != drawPile) {
+        _drawPile->removeFromParent();
+    }
+    _drawPile = drawPile;
+    _onDrawPileClick = callback;
+    _drawPilePressed = false;
+
+    if (_drawPile && _drawPile->getParent() != this) {
+        this->addChild(_drawPile, -1);
+    }
+}
+
+void GameView::showHint(int cardId) {
+    Node* target = cardId >= 0 ? getCardViewById(cardId) : _drawPile;
+    if (!target) return;
+
+    // 只改颜色不动位置，不与补间池冲突；闪两次后恢复原色
+    target->stopActionByTag(kHintActionTag);
+    auto blink = Sequence::create(
+        TintTo::create(0.15f, 255, 220, 90),
+        TintTo::create(0.15f, 255, 255, 255),
+        nullptr);
+    auto action = Repeat::create(blink, 2);
+    action->setTag(kHintActionTag);
+    target->runAction(action);
+}
+
+void GameView::_registerHitBounds(CardView* cardView) {
+    _hitGrid.insert(cardView->getCardId(), cardView->getBoundingBox(), ++_hitOrder);
+}
+
+int GameView::_hitTestCard(const Vec2& layerPos) const {
+    int bestId = -1;
+    int bestZ = 0;
+    unsigned bestOrder = 0;
+
+    // 只检查触点所在单元的候选，按 (层级, 登记序号) 取最上层，与渲染顺序一致
+    for (int cardId : _hitGrid.query(layerPos)) {
+        CardView* cardView = _cardViewsById[cardId];
+        if (!cardView || !cardView->isVisible()) continue;
+        if (!cardView->getBoundingBox().containsPoint(layerPos)) continue;
+
+        int z = cardView->getLocalZOrder();
+        unsigned order = _hitGrid.getOrder(cardId);
+        if (bestId < 0 || z > bestZ || (z == bestZ && order > bestOrder)) {
+            bestId = cardId;
+            bestZ = z;
+            bestOrder = order;
+        }
+    }
+    return bestId;
+}
+
+bool GameView::_onBoardTouchBegan(Touch* touch, Event* event) {
+    _pressedCardId = _hitTestCard(_playfieldLayer->convertToNodeSpace(touch->getLocation()));
+    if (_pressedCardId >= 0) {
+        // 点击反馈：轻微缩小
+        _cardViewsById[_pressedCardId]->setPressed(true);
+        return true;
+    }
+
+    // 主牌区在牌堆之上，未点中卡牌时再检查牌堆
+    if (_drawPile && _drawPile->isVisible()) {
+        Vec2 p = _drawPile->convertToNodeSpace(touch->getLocation());
+        Size s = _drawPile->getContentSize();
+        _drawPilePressed = Rect(0, 0, s.width, s.height).containsPoint(p);
+        return _drawPilePressed;
+    }
+    return false;
+}
+
+void GameView::_onBoardTouchEnded(Touch* touch, Event* event) {
+    // 与原先卡牌上的监听一致：按下即认定目标，松开时触发
+    if (_pressedCardId >= 0) {
+        int cardId = _pressedCardId;
+        _pressedCardId = -1;
+        _cardViewsById[cardId]->setPressed(false);
+        if (_onCardClick) _onCardClick(cardId);
+    }
+    else if (_drawPilePressed) {
+        _drawPilePressed = false;
+        if (_onDrawPileClick) _onDrawPileClick();
+    }
+}
+
+void GameView::_onBoardTouchCancelled(Touch* touch, Event* event) {
+    if (_pressedCardId >= 0) {
+        _cardViewsById[_pressedCardId]->setPressed(false);
+    }
+    _pressedCardId = -1;
+    _drawPilePressed = false;
+}
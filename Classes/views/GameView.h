@@ -1,47 +1,124 @@
 #pragma once
 #include "cocos2d.h"
 #include "CardView.h"
+#include "CardHitGrid.h"
+#include "CardTweenSystem.h"
+#include <functional>
 
 /**
  * @class GameView
- * @brief Ϸͼ
- * @responsibility ϷڵҪͼ㣨ͶṩɾͶӿڡ
+ * @brief 游戏主场景视图层
+ * @responsibility 管理游戏内的两个主要图层（主牌区和堆牌区），并提供卡牌增删和动画接口；
+ *                 统一接收棋盘上的触摸，通过均匀网格找出被点中的最上层卡牌或备用牌堆后回调 Controller。
  */
 class GameView : public cocos2d::Layer {
 public:
     static cocos2d::Scene* createScene();
     CREATE_FUNC(GameView);
 
+    /**
+     * @brief 析构时把仍在棋盘上的卡牌视图归还对象池
+     */
+    virtual ~GameView();
+
     virtual bool init();
 
     /**
-     * @brief ӿƵʾ
-     * @param cardView ͼ
-     * @param pos 
-     * @param zOrder Ⱦ㼶
+     * @brief 添加卡牌到显示层
+     * @param cardView 卡牌视图对象
+     * @param pos 相对坐标
+     * @param zOrder 渲染层级
      */
     void addCardToLayer(CardView* cardView, const cocos2d::Vec2& pos, int zOrder);
 
     /**
-     * @brief ſƶ
-     * @param cardId ID
-     * @param targetPos Ŀλ
-     * @param onComplete ɻص
+     * @brief 播放卡牌移动动画
+     * 由补间池统一驱动，不创建 Action；完成后的收尾以参数给出，无需回调。
+     * @param cardId 卡牌ID
+     * @param targetPos 目标位置
+     * @param zOrderOnComplete 落位后的层级 (CardTweenSystem::kKeepZOrder 表示保持飞行层级)
+     * @param completeFlags 落位后的附加动作 (CardTweenSystem::CompleteFlags)
+     */
+    void playMoveCardAnim(int cardId, const cocos2d::Vec2& targetPos,
+        int zOrderOnComplete = CardTweenSystem::kKeepZOrder, uint8_t completeFlags = CardTweenSystem::None);
+
+    /**
+     * @brief 每帧推进卡牌补间并批量处理落位
      */
-    void playMoveCardAnim(int cardId, const cocos2d::Vec2& targetPos, const std::function<void()>& onComplete);
+    void update(float dt) override;
 
     /**
-     * @brief IDҿ
-     * α Playfield  Stack ͼ㡣
+     * @brief 根据ID查找卡牌
+     * 通过 ID 索引表直接取下标，O(1)，不做 dynamic_cast。
      */
     CardView* getCardViewById(int cardId);
 
     /**
-     * @brief 
+     * @brief 获取卡牌视图索引表 (下标为卡牌 ID，空位为 nullptr)
+     * 表中指针在 clearBoard / removeCardView 之前保持有效，命令可直接缓存。
+     */
+    const std::vector<CardView*>& getCardViewTable() const { return _cardViewsById; }
+
+    /**
+     * @brief 移除单张卡牌视图并注销索引 (视图归还 CardViewPool)
+     */
+    void removeCardView(int cardId);
+
+    /**
+     * @brief 清空棋盘
+     * 卡牌视图归还 CardViewPool 而不是销毁。
      */
     void clearBoard();
 
+    /**
+     * @brief 设置卡牌点击回调 (整个棋盘共用一个)
+     * @param callback 接收被点中的最上层卡牌 ID
+     */
+    void setOnCardClickCallback(const std::function<void(int cardId)>& callback);
+
+    /**
+     * @brief 设置备用牌堆节点及其点击回调
+     * 牌堆由棋盘触摸统一判定，不再单独注册监听器；重复设置会替换旧节点。
+     * @param drawPile 牌堆节点 (添加到本视图)
+     * @param callback 点击回调
+     */
+    void setDrawPile(cocos2d::Node* drawPile, const std::function<void()>& callback);
+
+    /**
+     * @brief 短暂高亮提示的卡牌
+     * @param cardId 卡牌 ID，-1 表示高亮备用牌堆
+     */
+    void showHint(int cardId);
+
 private:
-    cocos2d::Node* _playfieldLayer; ///<  (Ϸ)
-    cocos2d::Node* _stackLayer;     ///<  (·)
+    // 棋盘触摸路由
+    bool _onBoardTouchBegan(cocos2d::Touch* touch, cocos2d::Event* event);
+    void _onBoardTouchEnded(cocos2d::Touch* touch, cocos2d::Event* event);
+    void _onBoardTouchCancelled(cocos2d::Touch* touch, cocos2d::Event* event);
+
+    /**
+     * @brief 找出包含该点的最上层可见卡牌
+     * @param layerPos 主牌区图层坐标
+     * @return int 卡牌 ID，未命中返回 -1
+     */
+    int _hitTestCard(const cocos2d::Vec2& layerPos) const;
+
+    /**
+     * @brief 按卡牌当前包围盒登记到点击网格
+     */
+    void _registerHitBounds(CardView* cardView);
+
+
+    cocos2d::Node* _playfieldLayer; ///< 主牌区容器 (上方)
+    cocos2d::Node* _stackLayer;     ///< 堆牌区容器 (下方)
+    std::vector<CardView*> _cardViewsById;  ///< 按卡牌 ID 索引的视图表 (由图层持有引用)
+
+    CardTweenSystem _tweens;                ///< 卡牌移动补间池
+    CardHitGrid _hitGrid;                   ///< 静止卡牌的点击网格 (主牌区图层坐标)
+    unsigned _hitOrder = 0;                 ///< 登记序号，层级相同时后登记的在上层
+    std::function<void(int)> _onCardClick;
+    cocos2d::Node* _drawPile = nullptr;     ///< 备用牌堆 (由本视图持有)
+    std::function<void()> _onDrawPileClick;
+    int _pressedCardId = -1;                ///< 本次触摸按下的卡牌，-1 表示无
+    bool _drawPilePressed = false;          ///< 本次触摸是否按在牌堆上
 };
\ No newline at end of file
@@ -12,34 +12,75 @@ bool LevelSelectScene::init() {
 
     auto visibleSize = Director::getInstance()->getVisibleSize();
 
-    // 1. 
+    // 1. 背景
     auto bg = LayerColor::create(Color4B(50, 50, 80, 255));
     this->addChild(bg);
 
-    // 2. 
+    // 2. 标题
     auto label = Label::createWithSystemFont("SELECT LEVEL", "Arial", 80);
     label->setPosition(Vec2(visibleSize.width / 2, visibleSize.height - 200));
     this->addChild(label);
 
-    // 3. ؿť
+    // 3. 关卡按钮生成
     Vector<MenuItem*> menuItems;
     for (int i = 1; i <= 3; ++i) {
         std::string text = StringUtils::format("Level %d", i);
         auto itemLabel = Label::createWithSystemFont(text, "Arial", 60);
 
-        auto item = MenuItemLabel::create(itemLabel, [i](Ref*) {
-            // л
-            auto gameScene = GameController::createGameScene(i);
-            Director::getInstance()->replaceScene(TransitionFade::create(0.5f, gameScene));
+        auto item = MenuItemLabel::create(itemLabel, [this, i](Ref*) {
+            // 切换场景 (资源就绪后才构建游戏场景)
+            this->_selectLevel(i);
             });
 
         item->setPosition(Vec2(visibleSize.width / 2, visibleSize.height - 400 - (i * 150)));
         menuItems.pushBack(item);
     }
 
+    // 无尽模式：使用第 1 关的布局，桌面清空后继续发新牌
+    auto endlessLabel = Label::createWithSystemFont("Endless", "Arial", 60);
+    auto endlessItem = MenuItemLabel::create(endlessLabel, [this](Ref*) {
+        this->_selectLevel(1, true);
+        });
+    endlessItem->setPosition(Vec2(visibleSize.width / 2, visibleSize.height - 400 - (4 * 150)));
+    menuItems.pushBack(endlessItem);
+
     auto menu = Menu::createWithArray(menuItems);
     menu->setPosition(Vec2::ZERO);
     this->addChild(menu);
 
+    // 4. 列表显示时即开始后台预加载：卡牌纹理异步解码，各关卡 JSON 在工作线程解析
+    _progressLabel = Label::createWithSystemFont("", "Arial", 40);
+    _progressLabel->setPosition(Vec2(visibleSize.width / 2, 150));
+    this->addChild(_progressLabel);
+
+    _preloader.setProgressCallback([this](float progress) {
+        _progressLabel->setString(progress < 1.0f
+            ? StringUtils::format("Loading %d%%", (int)(progress * 100))
+            : "");
+        });
+    _preloader.preloadTextures();
+    for (int i = 1; i <= 3; ++i) {
+        _preloader.preloadLevel(i);
+    }
+    this->scheduleUpdate();
+
     return true;
+}
+
+void LevelSelectScene::update(float dt) {
+    Scene::update(dt);
+    _preloader.update();
+}
+
+void LevelSelectScene::_selectLevel(int levelId, bool endless) {
+    if (_transitionPending) return;
+    _transitionPending = true;
+
+    _preloader.whenReady(levelId, [this, levelId, endless](const LevelConfig& config) {
+        // 配置与纹理均已驻留，构建场景时没有文件 I/O 与图片解码
+        auto gameScene = endless
+            ? GameController::createEndlessScene(levelId, config)
+            : GameController::createGameScene(levelId, config);
+        Director::getInstance()->replaceScene(TransitionFade::create(0.5f, gameScene));
+        });
 }
\ No newline at end of file
@@ -1,14 +1,32 @@
 #pragma once
 #include "cocos2d.h"
+#include "controllers/LevelPreloader.h"
 
 /**
  * @class LevelSelectScene
- * @brief ؿѡ񳡾
- * @responsibility չʾؿбл GameController Ϸ
+ * @brief 关卡选择场景
+ * @responsibility 展示关卡列表，同时在后台预加载关卡与卡牌纹理；点击后等资源就绪再切换到 GameController 创建的游戏场景。
  */
 class LevelSelectScene : public cocos2d::Scene {
 public:
     static cocos2d::Scene* createScene();
     virtual bool init();
     CREATE_FUNC(LevelSelectScene);
+
+    /**
+     * @brief 每帧驱动预加载器派发进度与就绪回调
+     */
+    void update(float dt) override;
+
+private:
+    /**
+     * @brief 选择关卡：资源就绪后切换场景 (重复点击只保留第一次)
+     * @param levelId 关卡 ID
+     * @param endless 是否以该关布局进入无尽模式
+     */
+    void _selectLevel(int levelId, bool endless = false);
+
+    LevelPreloader _preloader;                      ///< 关卡与纹理预加载器
+    cocos2d::Label* _progressLabel = nullptr;       ///< 加载进度提示
+    bool _transitionPending = false;                ///< 已选择关卡，等待资源就绪
 };
\ No newline at end of file
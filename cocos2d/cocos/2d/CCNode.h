@@ -1528,6 +1528,23 @@ public:
 
     /// @} end of Transformations
 
+    /**
+     * Returns a number that changes whenever the model view transform of the node is recomputed
+     * during visit, or markRenderContentDirty() is called. Versions are unique across all nodes.
+     * The renderer reuses the world-space vertices it produced in the previous frame for a
+     * TrianglesCommand whose version did not change.
+     *
+     * @return The render version of the node.
+     */
+    std::uint32_t getRenderVersion() const { return _renderVersion; }
+
+    /**
+     * Marks the vertex data drawn by this node as changed.
+     * Nodes that pass getRenderVersion() to their TrianglesCommand must call it whenever they modify
+     * the vertices or indices given to the command.
+     */
+    void markRenderContentDirty() { _renderVersion = ++s_globalRenderVersion; }
+
 
     /// @{
     /// @name Coordinate Converters
@@ -1853,6 +1870,7 @@ protected:
     mutable Mat4* _additionalTransform; ///< two transforms needed by additional transforms
     mutable bool _additionalTransformDirty; ///< transform dirty ?
     bool _transformUpdated;         ///< Whether or not the Transform object was updated since the last frame
+    std::uint32_t _renderVersion;   ///< Changes with the model view transform and the vertex data, see getRenderVersion()
 
 #if CC_LITTLE_ENDIAN
     union {
@@ -1875,6 +1893,7 @@ protected:
     float _globalZOrder;            ///< Global order used to sort the node
 
     static std::uint32_t s_globalOrderOfArrival;
+    static std::uint32_t s_globalRenderVersion;
 
     Vector<Node*> _children;        ///< array of children nodes
     Node *_parent;                  ///< weak reference to parent node
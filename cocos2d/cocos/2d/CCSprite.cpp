@@ -242,6 +242,7 @@ bool Sprite::initWithPolygon(const cocos2d::PolygonInfo &info)
     {
         _polyInfo = info;
         _renderMode = RenderMode::POLYGON;
+        markRenderContentDirty();
         Node::setContentSize(_polyInfo.getRect().size / _director->getContentScaleFactor());
         ret = true;
     }
@@ -732,6 +733,8 @@ void Sprite::updatePoly()
         // to avoid memcpy'ing stuff
         _polyInfo.setTriangles(triangles);
     }
+
+    markRenderContentDirty();
 }
 
 void Sprite::setCenterRectNormalized(const cocos2d::Rect &rectTopLeft)
@@ -837,6 +840,7 @@ void Sprite::setVertexRect(const Rect& rect)
 void Sprite::setTextureCoords(const Rect& rectInPoints)
 {
     setTextureCoords(rectInPoints, &_quad);
+    markRenderContentDirty();
 }
 
 void Sprite::setTextureCoords(const Rect& rectInPoints, V3F_C4B_T2F_Quad* outQuad)
@@ -1124,6 +1128,9 @@ void Sprite::draw(Renderer *renderer, const Mat4 &transform, uint32_t flags)
                                _polyInfo.triangles,
                                transform,
                                flags);
+        // the own matrix changes only along with the render version, see Node::processParentFlags()
+        if (&transform == &_modelViewTransform)
+            _trianglesCommand.setVertexVersion(getRenderVersion());
         renderer->addCommand(&_trianglesCommand);
         
 #if CC_SPRITE_DEBUG_DRAW
@@ -1502,6 +1509,7 @@ void Sprite::flipX()
             auto& v = _polyInfo.triangles.verts[i].vertices;
             v.x = _contentSize.width -v.x;
         }
+        markRenderContentDirty();
     }
     else
         // RenderMode:: Quad or Slice9
@@ -1518,6 +1526,7 @@ void Sprite::flipY()
             auto& v = _polyInfo.triangles.verts[i].vertices;
             v.y = _contentSize.height -v.y;
         }
+        markRenderContentDirty();
     }
     else
         // RenderMode:: Quad or Slice9
@@ -1547,6 +1556,7 @@ void Sprite::updateColor()
     // when switching from Quad to Slice9, the color will be obtained from _quad
     // so it is important to update _quad colors as well.
     _quad.bl.colors = _quad.tl.colors = _quad.br.colors = _quad.tr.colors = color4;
+    markRenderContentDirty();
 
     // renders using batch node
     if (_renderMode == RenderMode::QUAD_BATCHNODE)
@@ -1694,7 +1704,7 @@ void Sprite::setBatchNode(SpriteBatchNode *spriteBatchNode)
         _quad.br.vertices.set(x2, y1, 0);
         _quad.tl.vertices.set(x1, y2, 0);
         _quad.tr.vertices.set(x2, y2, 0);
-
+        markRenderContentDirty();
     }
     else
     {
@@ -1746,6 +1756,7 @@ void Sprite::setPolygonInfo(const PolygonInfo& info)
 {
     _polyInfo = info;
     _renderMode = RenderMode::POLYGON;
+    markRenderContentDirty();
 }
 
 void Sprite::setMVPMatrixUniform()
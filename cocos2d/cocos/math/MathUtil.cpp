@@ -20,7 +20,9 @@ This file was modified to fit the cocos2d-x project
 */
 
 #include "math/MathUtil.h"
+#include "math/Mat4.h"
 #include "base/ccMacros.h"
+#include "base/ccTypes.h"
 
 #if (CC_TARGET_PLATFORM == CC_PLATFORM_ANDROID)
 #include <cpu-features.h>
@@ -59,6 +61,9 @@ This file was modified to fit the cocos2d-x project
 #define INCLUDE_SSE
 #endif
 
+// MathUtilC first: the vertex and index routines of the SIMD versions finish their tails with it.
+#include "math/MathUtil.inl"
+
 #ifdef INCLUDE_NEON32
 #include "math/MathUtilNeon.inl"
 #endif
@@ -71,8 +76,6 @@ This file was modified to fit the cocos2d-x project
 #include "math/MathUtilSSE.inl"
 #endif
 
-#include "math/MathUtil.inl"
-
 NS_CC_MATH_BEGIN
 
 void MathUtil::smooth(float* x, float target, float elapsedTime, float responseTime)
@@ -276,4 +279,27 @@ void MathUtil::crossVec3(const float* v1, const float* v2, float* dst)
 #endif
 }
 
+void MathUtil::transformVertices(V3F_C4B_T2F* dst, const V3F_C4B_T2F* src, size_t count, const Mat4& transform)
+{
+    static_assert(sizeof(V3F_C4B_T2F) == 6 * sizeof(float), "transformVertices assumes 24 byte vertices");
+#if defined (USE_NEON64)
+    MathUtilNeon64::transformVertices(transform.m, src, count, dst);
+#elif defined (USE_SSE)
+    transformVertices(transform.col, src, count, dst);
+#else
+    MathUtilC::transformVertices(transform.m, src, count, dst);
+#endif
+}
+
+void MathUtil::transformIndices(unsigned short* dst, const unsigned short* src, size_t count, unsigned short offset)
+{
+#if defined (USE_NEON64)
+    MathUtilNeon64::transformIndices(src, count, offset, dst);
+#elif defined (USE_SSE) && defined (__SSE2__)
+    transformIndices(src, count, offset, dst);
+#else
+    MathUtilC::transformIndices(src, count, offset, dst);
+#endif
+}
+
 NS_CC_MATH_END
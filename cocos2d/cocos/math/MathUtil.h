@@ -27,6 +27,10 @@
 #include <xmmintrin.h>
 #endif
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
 #include "math/CCMathBase.h"
 
 /**
@@ -36,6 +40,9 @@
 
 NS_CC_MATH_BEGIN
 
+class Mat4;
+struct V3F_C4B_T2F;
+
 /**
  * Defines a math utility class.
  *
@@ -88,6 +95,30 @@ public:
      * @return interpolated float value
      */
     static float lerp(float from, float to, float alpha);
+
+    /**
+     * Transforms the positions of vertices by a matrix and copies their colors and
+     * texture coordinates unchanged. The positions are treated as points (w = 1) and
+     * no perspective divide is done, the same as Mat4::transformPoint.
+     * Vertices are processed in blocks of four with SSE or NEON when available.
+     *
+     * @param dst the destination vertices. May be the same as src but must not partially overlap it.
+     * @param src the source vertices.
+     * @param count the number of vertices.
+     * @param transform the matrix applied to every position.
+     */
+    static void transformVertices(V3F_C4B_T2F* dst, const V3F_C4B_T2F* src, size_t count, const Mat4& transform);
+
+    /**
+     * Copies indices adding the same offset to each of them, as done when the vertices
+     * they refer to are appended to a shared vertex buffer.
+     *
+     * @param dst the destination indices. May be the same as src but must not partially overlap it.
+     * @param src the source indices.
+     * @param count the number of indices.
+     * @param offset the value added to every index.
+     */
+    static void transformIndices(unsigned short* dst, const unsigned short* src, size_t count, unsigned short offset);
 private:
     //Indicates that if neon is enabled
     static bool isNeon32Enabled();
@@ -109,6 +140,11 @@ private:
     static void transposeMatrix(const __m128 m[4], __m128 dst[4]);
         
     static void transformVec4(const __m128 m[4], const __m128& v, __m128& dst);
+
+    static void transformVertices(const __m128 m[4], const V3F_C4B_T2F* src, size_t count, V3F_C4B_T2F* dst);
+#endif
+#ifdef __SSE2__
+    static void transformIndices(const unsigned short* src, size_t count, unsigned short offset, unsigned short* dst);
 #endif
     static void addMatrix(const float* m, float scalar, float* dst);
 
@@ -42,6 +42,10 @@ public:
     inline static void transformVec4(const float* m, const float* v, float* dst);
     
     inline static void crossVec3(const float* v1, const float* v2, float* dst);
+
+    inline static void transformVertices(const float* m, const V3F_C4B_T2F* src, size_t count, V3F_C4B_T2F* dst);
+
+    inline static void transformIndices(const unsigned short* src, size_t count, unsigned short offset, unsigned short* dst);
 };
 
 inline void MathUtilC::addMatrix(const float* m, float scalar, float* dst)
@@ -215,4 +219,27 @@ inline void MathUtilC::crossVec3(const float* v1, const float* v2, float* dst)
     dst[2] = z;
 }
 
+inline void MathUtilC::transformVertices(const float* m, const V3F_C4B_T2F* src, size_t count, V3F_C4B_T2F* dst)
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        const Vec3& v = src[i].vertices;
+        float x = v.x * m[0] + v.y * m[4] + v.z * m[8] + m[12];
+        float y = v.x * m[1] + v.y * m[5] + v.z * m[9] + m[13];
+        float z = v.x * m[2] + v.y * m[6] + v.z * m[10] + m[14];
+
+        dst[i].colors = src[i].colors;
+        dst[i].texCoords = src[i].texCoords;
+        dst[i].vertices.set(x, y, z);
+    }
+}
+
+inline void MathUtilC::transformIndices(const unsigned short* src, size_t count, unsigned short offset, unsigned short* dst)
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        dst[i] = src[i] + offset;
+    }
+}
+
 NS_CC_MATH_END
@@ -18,6 +18,8 @@
  This file was modified to fit the cocos2d-x project
  */
 
+#include <arm_neon.h>
+
 NS_CC_MATH_BEGIN
 
 class MathUtilNeon64
@@ -42,6 +44,10 @@ public:
     inline static void transformVec4(const float* m, const float* v, float* dst);
     
     inline static void crossVec3(const float* v1, const float* v2, float* dst);
+
+    inline static void transformVertices(const float* m, const V3F_C4B_T2F* src, size_t count, V3F_C4B_T2F* dst);
+
+    inline static void transformIndices(const unsigned short* src, size_t count, unsigned short offset, unsigned short* dst);
 };
 
 inline void MathUtilNeon64::addMatrix(const float* m, float scalar, float* dst)
@@ -262,4 +268,70 @@ inline void MathUtilNeon64::crossVec3(const float* v1, const float* v2, float* d
     );
 }
 
+inline void MathUtilNeon64::transformVertices(const float* m, const V3F_C4B_T2F* src, size_t count, V3F_C4B_T2F* dst)
+{
+    const float* in = (const float*)src;
+    float* out = (float*)dst;
+    size_t blocks = count / 4;
+    for (size_t i = 0; i < blocks; ++i, in += 24, out += 24)
+    {
+        // Four vertices are 24 floats: x y z c | u v x y | z c u v | x y z c | u v x y | z c u v
+        float32x4_t a0 = vld1q_f32(in);
+        float32x4_t a1 = vld1q_f32(in + 4);
+        float32x4_t a2 = vld1q_f32(in + 8);
+        float32x4_t a3 = vld1q_f32(in + 12);
+        float32x4_t a4 = vld1q_f32(in + 16);
+        float32x4_t a5 = vld1q_f32(in + 20);
+
+        float32x4_t xy01 = vcombine_f32(vget_low_f32(a0), vget_high_f32(a1));     // x0 y0 x1 y1
+        float32x4_t xy23 = vcombine_f32(vget_low_f32(a3), vget_high_f32(a4));     // x2 y2 x3 y3
+        float32x4_t zc01 = vcombine_f32(vget_high_f32(a0), vget_low_f32(a2));     // z0 c0 z1 c1
+        float32x4_t zc23 = vcombine_f32(vget_high_f32(a3), vget_low_f32(a5));     // z2 c2 z3 c3
+        float32x4_t x = vuzp1q_f32(xy01, xy23);
+        float32x4_t y = vuzp2q_f32(xy01, xy23);
+        float32x4_t z = vuzp1q_f32(zc01, zc23);
+        float32x4_t c = vuzp2q_f32(zc01, zc23);
+
+        // Same order of operations as MathUtilC::transformVec4 with w = 1.
+        float32x4_t rx = vaddq_f32(vmlaq_n_f32(vmlaq_n_f32(vmulq_n_f32(x, m[0]), y, m[4]), z, m[8]), vdupq_n_f32(m[12]));
+        float32x4_t ry = vaddq_f32(vmlaq_n_f32(vmlaq_n_f32(vmulq_n_f32(x, m[1]), y, m[5]), z, m[9]), vdupq_n_f32(m[13]));
+        float32x4_t rz = vaddq_f32(vmlaq_n_f32(vmlaq_n_f32(vmulq_n_f32(x, m[2]), y, m[6]), z, m[10]), vdupq_n_f32(m[14]));
+
+        // Put the results back in place; colors and texture coordinates are only moved, never computed on.
+        float32x4_t rxy01 = vzip1q_f32(rx, ry);     // x0 y0 x1 y1
+        float32x4_t rxy23 = vzip2q_f32(rx, ry);     // x2 y2 x3 y3
+        float32x4_t rzc01 = vzip1q_f32(rz, c);      // z0 c0 z1 c1
+        float32x4_t rzc23 = vzip2q_f32(rz, c);      // z2 c2 z3 c3
+
+        vst1q_f32(out,      vcombine_f32(vget_low_f32(rxy01), vget_low_f32(rzc01)));
+        vst1q_f32(out + 4,  vcombine_f32(vget_low_f32(a1), vget_high_f32(rxy01)));
+        vst1q_f32(out + 8,  vcombine_f32(vget_high_f32(rzc01), vget_high_f32(a2)));
+        vst1q_f32(out + 12, vcombine_f32(vget_low_f32(rxy23), vget_low_f32(rzc23)));
+        vst1q_f32(out + 16, vcombine_f32(vget_low_f32(a4), vget_high_f32(rxy23)));
+        vst1q_f32(out + 20, vcombine_f32(vget_high_f32(rzc23), vget_high_f32(a5)));
+    }
+
+    size_t done = blocks * 4;
+    MathUtilC::transformVertices(m, src + done, count - done, dst + done);
+}
+
+inline void MathUtilNeon64::transformIndices(const unsigned short* src, size_t count, unsigned short offset, unsigned short* dst)
+{
+    const uint16x8_t o = vdupq_n_u16(offset);
+    size_t blocks = count / 8;
+    for (size_t i = 0; i < blocks; ++i)
+    {
+        vst1q_u16(dst + i * 8, vaddq_u16(vld1q_u16(src + i * 8), o));
+    }
+
+    size_t done = blocks * 8;
+    if (count - done >= 4)
+    {
+        // sprites have six indices: one half block and two scalars
+        vst1_u16(dst + done, vadd_u16(vld1_u16(src + done), vget_low_u16(o)));
+        done += 4;
+    }
+    MathUtilC::transformIndices(src + done, count - done, offset, dst + done);
+}
+
 NS_CC_MATH_END
@@ -151,6 +151,92 @@ void MathUtil::transformVec4(const __m128 m[4], const __m128& v, __m128& dst)
                      );
 }
 
+void MathUtil::transformVertices(const __m128 m[4], const V3F_C4B_T2F* src, size_t count, V3F_C4B_T2F* dst)
+{
+    // Rows of the matrix as splatted scalars, so that four vertices are transformed at once
+    // with their x, y and z in separate registers.
+    const __m128 m0  = _mm_shuffle_ps(m[0], m[0], _MM_SHUFFLE(0, 0, 0, 0));
+    const __m128 m1  = _mm_shuffle_ps(m[0], m[0], _MM_SHUFFLE(1, 1, 1, 1));
+    const __m128 m2  = _mm_shuffle_ps(m[0], m[0], _MM_SHUFFLE(2, 2, 2, 2));
+    const __m128 m4  = _mm_shuffle_ps(m[1], m[1], _MM_SHUFFLE(0, 0, 0, 0));
+    const __m128 m5  = _mm_shuffle_ps(m[1], m[1], _MM_SHUFFLE(1, 1, 1, 1));
+    const __m128 m6  = _mm_shuffle_ps(m[1], m[1], _MM_SHUFFLE(2, 2, 2, 2));
+    const __m128 m8  = _mm_shuffle_ps(m[2], m[2], _MM_SHUFFLE(0, 0, 0, 0));
+    const __m128 m9  = _mm_shuffle_ps(m[2], m[2], _MM_SHUFFLE(1, 1, 1, 1));
+    const __m128 m10 = _mm_shuffle_ps(m[2], m[2], _MM_SHUFFLE(2, 2, 2, 2));
+    const __m128 m12 = _mm_shuffle_ps(m[3], m[3], _MM_SHUFFLE(0, 0, 0, 0));
+    const __m128 m13 = _mm_shuffle_ps(m[3], m[3], _MM_SHUFFLE(1, 1, 1, 1));
+    const __m128 m14 = _mm_shuffle_ps(m[3], m[3], _MM_SHUFFLE(2, 2, 2, 2));
+
+    const float* in = (const float*)src;
+    float* out = (float*)dst;
+    size_t blocks = count / 4;
+    for (size_t i = 0; i < blocks; ++i, in += 24, out += 24)
+    {
+        // Four vertices are 24 floats: x y z c | u v x y | z c u v | x y z c | u v x y | z c u v
+        __m128 a0 = _mm_loadu_ps(in);
+        __m128 a1 = _mm_loadu_ps(in + 4);
+        __m128 a2 = _mm_loadu_ps(in + 8);
+        __m128 a3 = _mm_loadu_ps(in + 12);
+        __m128 a4 = _mm_loadu_ps(in + 16);
+        __m128 a5 = _mm_loadu_ps(in + 20);
+
+        __m128 xy01 = _mm_shuffle_ps(a0, a1, _MM_SHUFFLE(3, 2, 1, 0));     // x0 y0 x1 y1
+        __m128 xy23 = _mm_shuffle_ps(a3, a4, _MM_SHUFFLE(3, 2, 1, 0));     // x2 y2 x3 y3
+        __m128 z01 = _mm_shuffle_ps(a0, a2, _MM_SHUFFLE(0, 0, 2, 2));      // z0 z0 z1 z1
+        __m128 z23 = _mm_shuffle_ps(a3, a5, _MM_SHUFFLE(0, 0, 2, 2));      // z2 z2 z3 z3
+        __m128 x = _mm_shuffle_ps(xy01, xy23, _MM_SHUFFLE(2, 0, 2, 0));
+        __m128 y = _mm_shuffle_ps(xy01, xy23, _MM_SHUFFLE(3, 1, 3, 1));
+        __m128 z = _mm_shuffle_ps(z01, z23, _MM_SHUFFLE(2, 0, 2, 0));
+
+        // Same order of operations as MathUtilC::transformVec4 with w = 1.
+        __m128 rx = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x, m0), _mm_mul_ps(y, m4)), _mm_mul_ps(z, m8)), m12);
+        __m128 ry = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x, m1), _mm_mul_ps(y, m5)), _mm_mul_ps(z, m9)), m13);
+        __m128 rz = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x, m2), _mm_mul_ps(y, m6)), _mm_mul_ps(z, m10)), m14);
+
+        // Put the results back in place; colors and texture coordinates are only moved, never computed on.
+        __m128 rxy01 = _mm_unpacklo_ps(rx, ry);                                                     // x0 y0 x1 y1
+        __m128 rxy23 = _mm_unpackhi_ps(rx, ry);                                                     // x2 y2 x3 y3
+        __m128 zc0 = _mm_shuffle_ps(rz, a0, _MM_SHUFFLE(3, 3, 0, 0));                               // z0 z0 c0 c0
+        __m128 zc2 = _mm_shuffle_ps(rz, a3, _MM_SHUFFLE(3, 3, 2, 2));                               // z2 z2 c2 c2
+
+        _mm_storeu_ps(out,      _mm_shuffle_ps(rxy01, zc0, _MM_SHUFFLE(2, 0, 1, 0)));
+        _mm_storeu_ps(out + 4,  _mm_shuffle_ps(a1, rxy01, _MM_SHUFFLE(3, 2, 1, 0)));
+        _mm_storeu_ps(out + 8,  _mm_move_ss(a2, _mm_shuffle_ps(rz, rz, _MM_SHUFFLE(1, 1, 1, 1))));
+        _mm_storeu_ps(out + 12, _mm_shuffle_ps(rxy23, zc2, _MM_SHUFFLE(2, 0, 1, 0)));
+        _mm_storeu_ps(out + 16, _mm_shuffle_ps(a4, rxy23, _MM_SHUFFLE(3, 2, 1, 0)));
+        _mm_storeu_ps(out + 20, _mm_move_ss(a5, _mm_shuffle_ps(rz, rz, _MM_SHUFFLE(3, 3, 3, 3))));
+    }
+
+    size_t done = blocks * 4;
+    MathUtilC::transformVertices((const float*)m, src + done, count - done, dst + done);
+}
+
+#endif
+
+#ifdef __SSE2__
+
+void MathUtil::transformIndices(const unsigned short* src, size_t count, unsigned short offset, unsigned short* dst)
+{
+    const __m128i o = _mm_set1_epi16((short)offset);
+    size_t blocks = count / 8;
+    for (size_t i = 0; i < blocks; ++i)
+    {
+        __m128i v = _mm_loadu_si128((const __m128i*)(src + i * 8));
+        _mm_storeu_si128((__m128i*)(dst + i * 8), _mm_add_epi16(v, o));
+    }
+
+    size_t done = blocks * 8;
+    if (count - done >= 4)
+    {
+        // sprites have six indices: one half block and two scalars
+        __m128i v = _mm_loadl_epi64((const __m128i*)(src + done));
+        _mm_storel_epi64((__m128i*)(dst + done), _mm_add_epi16(v, o));
+        done += 4;
+    }
+    MathUtilC::transformIndices(src + done, count - done, offset, dst + done);
+}
+
 #endif
 
 
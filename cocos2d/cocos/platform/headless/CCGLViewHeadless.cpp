@@ -0,0 +1,89 @@
+/****************************************************************************
+ Copyright (c) 2018-2019 Xiamen Yaji Software Co., Ltd.
+
+ http://www.cocos2d-x.org
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+ ****************************************************************************/
+
+#include "platform/headless/CCGLViewHeadless.h"
+#include "base/CCDirector.h"
+
+#include <chrono>
+
+NS_CC_BEGIN
+
+GLViewHeadless* GLViewHeadless::create(const std::string& viewName, const Size& frameSize, unsigned int maxFrames)
+{
+    auto ret = new (std::nothrow) GLViewHeadless;
+    if(ret && ret->init(viewName, frameSize, maxFrames)) {
+        ret->autorelease();
+        return ret;
+    }
+    CC_SAFE_DELETE(ret);
+    return nullptr;
+}
+
+bool GLViewHeadless::init(const std::string& viewName, const Size& frameSize, unsigned int maxFrames)
+{
+    setViewName(viewName);
+    setFrameSize(frameSize.width, frameSize.height);
+    _maxFrames = maxFrames;
+    _ready = true;
+    return true;
+}
+
+unsigned int GLViewHeadless::runFrames(unsigned int frames)
+{
+    auto director = Director::getInstance();
+    auto firstFrame = _frameCount;
+
+    // Director may purge itself and end() the view inside mainLoop()
+    retain();
+    _frameTimes.reserve(_frameTimes.size() + frames);
+    for (unsigned int i = 0; i < frames && _ready; ++i)
+    {
+        auto start = std::chrono::steady_clock::now();
+        director->mainLoop();
+        std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+        _frameTimes.push_back(elapsed.count());
+    }
+    auto drawnFrames = _frameCount - firstFrame;
+    release();
+    return drawnFrames;
+}
+
+void GLViewHeadless::end()
+{
+    _ready = false;
+    // Release self, the same as the desktop GLView. Director does not release it after end().
+    release();
+}
+
+void GLViewHeadless::swapBuffers()
+{
+    ++_frameCount;
+}
+
+bool GLViewHeadless::windowShouldClose()
+{
+    return _maxFrames != 0 && _frameCount >= _maxFrames;
+}
+
+NS_CC_END
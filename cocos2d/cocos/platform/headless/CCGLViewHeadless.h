@@ -0,0 +1,94 @@
+/****************************************************************************
+ Copyright (c) 2018-2019 Xiamen Yaji Software Co., Ltd.
+
+ http://www.cocos2d-x.org
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+ ****************************************************************************/
+
+#pragma once
+
+#include "platform/CCGLView.h"
+
+#include <vector>
+
+NS_CC_BEGIN
+
+/**
+ * @addtogroup platform
+ * @{
+ */
+
+/**
+ * A GLView without window or context, used with the null rendering backend.
+ * Director renders into it as usual; frames are only counted.
+ * Call runFrames() to drive Director::mainLoop() back to back, or give a frame limit to
+ * create() and let Application::run() stop when windowShouldClose() turns true.
+ */
+class CC_DLL GLViewHeadless : public GLView
+{
+public:
+    /**
+     * @param viewName The name of the view.
+     * @param frameSize The frame size in pixels.
+     * @param maxFrames windowShouldClose() returns true after this many frames, 0 means never.
+     * @return An autoreleased GLViewHeadless, nullptr on failure.
+     */
+    static GLViewHeadless* create(const std::string& viewName, const Size& frameSize, unsigned int maxFrames = 0);
+
+    /**
+     * Run Director::mainLoop() `frames` times without frame pacing, timing each call.
+     * Stops early if the view has been ended.
+     * @param frames The number of main loop iterations.
+     * @return The number of frames Director drew during the call.
+     */
+    unsigned int runFrames(unsigned int frames);
+
+    /** Frames drawn (swapBuffers() calls) since creation. */
+    unsigned int getFrameCount() const { return _frameCount; }
+
+    /** Wall time in milliseconds of every main loop iteration run by runFrames(). */
+    const std::vector<double>& getFrameTimes() const { return _frameTimes; }
+
+    virtual void end() override;
+    virtual bool isOpenGLReady() override { return _ready; }
+    virtual void swapBuffers() override;
+    virtual void setIMEKeyboardState(bool open) override {}
+    virtual bool windowShouldClose() override;
+
+#if (CC_TARGET_PLATFORM == CC_PLATFORM_WIN32)
+    virtual HWND getWin32Window() override { return nullptr; }
+#endif /* (CC_TARGET_PLATFORM == CC_PLATFORM_WIN32) */
+
+protected:
+    GLViewHeadless() = default;
+    virtual ~GLViewHeadless() = default;
+
+    bool init(const std::string& viewName, const Size& frameSize, unsigned int maxFrames);
+
+    bool _ready = false;
+    unsigned int _maxFrames = 0;
+    unsigned int _frameCount = 0;
+    std::vector<double> _frameTimes;
+};
+
+// end of platform group
+/// @}
+
+NS_CC_END
@@ -43,6 +43,7 @@
 #include "base/CCEventType.h"
 #include "2d/CCCamera.h"
 #include "2d/CCScene.h"
+#include "math/MathUtil.h"
 #include "xxhash.h"
 
 #include "renderer/backend/Backend.h"
@@ -263,8 +264,12 @@ void Renderer::processRenderCommand(RenderCommand* command)
                 drawBatchedTriangles();
 
                 _queuedTotalIndexCount = _queuedTotalVertexCount = 0;
-#ifdef CC_USE_METAL
                 _queuedIndexCount = _queuedVertexCount = 0;
+                // filling restarts at the beginning of _verts, over data of this and the previous frame
+                _triangleSlots.clear();
+                _prevTriangleSlots.clear();
+                _prevTriangleSlotCursor = 0;
+#ifdef CC_USE_METAL
                 _triangleCommandBufferManager.prepareNextBuffer();
                 _vertexBuffer = _triangleCommandBufferManager.getVertexBuffer();
                 _indexBuffer = _triangleCommandBufferManager.getIndexBuffer();
@@ -273,10 +278,8 @@ void Renderer::processRenderCommand(RenderCommand* command)
             
             // queue it
             _queuedTriangleCommands.push_back(cmd);
-#ifdef CC_USE_METAL
             _queuedIndexCount += cmd->getIndexCount();
             _queuedVertexCount += cmd->getVertexCount();
-#endif
             _queuedTotalVertexCount += cmd->getVertexCount();
             _queuedTotalIndexCount += cmd->getIndexCount();
 
@@ -390,6 +393,10 @@ void Renderer::endFrame()
 #endif
     _queuedTotalIndexCount = 0;
     _queuedTotalVertexCount = 0;
+
+    _prevTriangleSlots.swap(_triangleSlots);
+    _triangleSlots.clear();
+    _prevTriangleSlotCursor = 0;
 }
 
 void Renderer::clean()
@@ -525,26 +532,53 @@ void Renderer::setViewPort(int x, int y, unsigned int w, unsigned int h)
     _viewport.h = h;
 }
 
-void Renderer::fillVerticesAndIndices(const TrianglesCommand* cmd, unsigned int vertexBufferOffset)
+void Renderer::fillVerticesAndIndices(const TrianglesCommand* cmd, unsigned int indexBase)
 {
-    size_t vertexCount = cmd->getVertexCount();
-    memcpy(&_verts[_filledVertex], cmd->getVertices(), sizeof(V3F_C4B_T2F) * vertexCount);
-    
-    // fill vertex, and convert them to world coordinates
-    const Mat4& modelView = cmd->getModelView();
-    for (size_t i=0; i < vertexCount; ++i)
+    unsigned int vertexCount = (unsigned int)cmd->getVertexCount();
+    unsigned int indexCount = (unsigned int)cmd->getIndexCount();
+    uint32_t version = cmd->getVertexVersion();
+
+    bool reused = false;
+    if (version != 0)
     {
-        modelView.transformPoint(&(_verts[i + _filledVertex].vertices));
+        // previous frame slots are sorted by offset, skip the ones already passed
+        while (_prevTriangleSlotCursor < _prevTriangleSlots.size() &&
+               _prevTriangleSlots[_prevTriangleSlotCursor].vertexOffset < _filledVertex)
+            ++_prevTriangleSlotCursor;
+
+        if (_prevTriangleSlotCursor < _prevTriangleSlots.size())
+        {
+            const auto& slot = _prevTriangleSlots[_prevTriangleSlotCursor];
+            reused = slot.cmd == cmd && slot.version == version &&
+                     slot.vertexOffset == _filledVertex && slot.vertexCount == vertexCount &&
+                     slot.indexOffset == _filledIndex && slot.indexCount == indexCount &&
+                     slot.indexBase == indexBase;
+        }
+
+        TriangleSlot slot;
+        slot.cmd = cmd;
+        slot.version = version;
+        slot.vertexOffset = _filledVertex;
+        slot.vertexCount = vertexCount;
+        slot.indexOffset = _filledIndex;
+        slot.indexCount = indexCount;
+        slot.indexBase = indexBase;
+        _triangleSlots.push_back(slot);
     }
-    
-    // fill index
-    const unsigned short* indices = cmd->getIndices();
-    size_t indexCount = cmd->getIndexCount();
-    for (size_t i = 0; i < indexCount; ++i)
+
+    if (reused)
     {
-        _indices[_filledIndex + i] = vertexBufferOffset + _filledVertex + indices[i];
+        _reusedVertices += vertexCount;
     }
-    
+    else
+    {
+        // fill vertex, converting them to world coordinates on the way into the batch buffer
+        MathUtil::transformVertices(&_verts[_filledVertex], cmd->getVertices(), vertexCount, cmd->getModelView());
+
+        // fill index
+        MathUtil::transformIndices(&_indices[_filledIndex], cmd->getIndices(), indexCount, (unsigned short)indexBase);
+    }
+
     _filledVertex += vertexCount;
     _filledIndex += indexCount;
 }
@@ -555,15 +589,19 @@ void Renderer::drawBatchedTriangles()
         return;
     
     /************** 1: Setup up vertices/indices *************/
-#ifdef CC_USE_METAL
+    // every flush of the frame fills its own range of _verts and _indices
     unsigned int vertexBufferFillOffset = _queuedTotalVertexCount - _queuedVertexCount;
     unsigned int indexBufferFillOffset = _queuedTotalIndexCount - _queuedIndexCount;
+#ifdef CC_USE_METAL
+    unsigned int vertexBufferOffset = vertexBufferFillOffset;
+    unsigned int indexBufferOffset = indexBufferFillOffset;
 #else
-    unsigned int vertexBufferFillOffset = 0;
-    unsigned int indexBufferFillOffset = 0;
+    // the whole GPU buffer is replaced by the range of this flush
+    unsigned int vertexBufferOffset = 0;
+    unsigned int indexBufferOffset = 0;
 #endif
 
-    _triBatchesToDraw[0].offset = indexBufferFillOffset;
+    _triBatchesToDraw[0].offset = indexBufferOffset;
     _triBatchesToDraw[0].indicesToDraw = 0;
     _triBatchesToDraw[0].cmd = nullptr;
     
@@ -571,15 +609,15 @@ void Renderer::drawBatchedTriangles()
     int prevMaterialID = -1;
     bool firstCommand = true;
 
-    _filledVertex = 0;
-    _filledIndex = 0;
+    _filledVertex = vertexBufferFillOffset;
+    _filledIndex = indexBufferFillOffset;
 
     for(const auto& cmd : _queuedTriangleCommands)
     {
         auto currentMaterialID = cmd->getMaterialID();
         const bool batchable = !cmd->isSkipBatching();
         
-        fillVerticesAndIndices(cmd, vertexBufferFillOffset);
+        fillVerticesAndIndices(cmd, vertexBufferOffset + _filledVertex - vertexBufferFillOffset);
         
         // in the same batch ?
         if (batchable && (prevMaterialID == currentMaterialID || firstCommand))
@@ -617,12 +655,14 @@ void Renderer::drawBatchedTriangles()
         firstCommand = false;
     }
     batchesTotal++;
+    unsigned int filledVertexCount = _filledVertex - vertexBufferFillOffset;
+    unsigned int filledIndexCount = _filledIndex - indexBufferFillOffset;
 #ifdef CC_USE_METAL
-    _vertexBuffer->updateSubData(_verts, vertexBufferFillOffset * sizeof(_verts[0]), _filledVertex * sizeof(_verts[0]));
-    _indexBuffer->updateSubData(_indices, indexBufferFillOffset * sizeof(_indices[0]), _filledIndex * sizeof(_indices[0]));
+    _vertexBuffer->updateSubData(&_verts[vertexBufferFillOffset], vertexBufferOffset * sizeof(_verts[0]), filledVertexCount * sizeof(_verts[0]));
+    _indexBuffer->updateSubData(&_indices[indexBufferFillOffset], indexBufferOffset * sizeof(_indices[0]), filledIndexCount * sizeof(_indices[0]));
 #else
-    _vertexBuffer->updateData(_verts, _filledVertex * sizeof(_verts[0]));
-    _indexBuffer->updateData(_indices,  _filledIndex * sizeof(_indices[0]));
+    _vertexBuffer->updateData(&_verts[vertexBufferFillOffset], filledVertexCount * sizeof(_verts[0]));
+    _indexBuffer->updateData(&_indices[indexBufferFillOffset],  filledIndexCount * sizeof(_indices[0]));
 #endif
 
     /************** 2: Draw *************/
@@ -646,10 +686,8 @@ void Renderer::drawBatchedTriangles()
     /************** 3: Cleanup *************/
     _queuedTriangleCommands.clear();
 
-#ifdef CC_USE_METAL
     _queuedIndexCount = 0;
     _queuedVertexCount = 0;
-#endif
 }
 
 void Renderer::drawCustomCommand(RenderCommand *command)
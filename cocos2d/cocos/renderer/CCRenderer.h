@@ -174,8 +174,10 @@ public:
     ssize_t getDrawnVertices() const { return _drawnVertices; }
     /* RenderCommands (except) TrianglesCommand should update this value */
     void addDrawnVertices(ssize_t number) { _drawnVertices += number; };
+    /* returns the number of batched vertices kept from the previous frame instead of being transformed again */
+    ssize_t getReusedVertices() const { return _reusedVertices; }
     /* clear draw stats */
-    void clearDrawStats() { _drawnBatches = _drawnVertices = 0; }
+    void clearDrawStats() { _drawnBatches = _drawnVertices = _reusedVertices = 0; }
 
     /**
      Set render targets. If not set, will use default render targets. It will effect all commands.
@@ -469,7 +471,13 @@ protected:
     void visitRenderQueue(RenderQueue& queue);
     void doVisitRenderQueue(const std::vector<RenderCommand*>&);
 
-    void fillVerticesAndIndices(const TrianglesCommand* cmd, unsigned int vertexBufferOffset);
+    /**
+     * Append the world-space vertices and rebased indices of a command at _filledVertex and _filledIndex.
+     * Skips the work when the previous frame left the same data there, see _prevTriangleSlots.
+     * @param cmd The command to append.
+     * @param indexBase Position of the command's first vertex in the vertex buffer, added to its indices.
+     */
+    void fillVerticesAndIndices(const TrianglesCommand* cmd, unsigned int indexBase);
     void beginRenderPass(RenderCommand*); /// Begin a render pass.
     
     /**
@@ -523,12 +531,32 @@ protected:
     unsigned int _queuedTotalIndexCount = 0;
     unsigned int _queuedVertexCount = 0;
     unsigned int _queuedIndexCount = 0;
+    // _verts and _indices positions being filled. Every flush of a frame fills its own range,
+    // so the arrays still hold the whole previous frame when the next one is filled.
     unsigned int _filledIndex = 0;
     unsigned int _filledVertex = 0;
 
+    // Where a TrianglesCommand with a vertex version was filled into _verts and _indices
+    struct TriangleSlot
+    {
+        const TrianglesCommand* cmd = nullptr;
+        uint32_t version = 0;
+        unsigned int vertexOffset = 0;
+        unsigned int vertexCount = 0;
+        unsigned int indexOffset = 0;
+        unsigned int indexCount = 0;
+        unsigned int indexBase = 0;
+    };
+    // Slots of the current frame, and of the previous one, in increasing offset order.
+    // A command found at the same offsets with the same version is not filled again.
+    std::vector<TriangleSlot> _triangleSlots;
+    std::vector<TriangleSlot> _prevTriangleSlots;
+    size_t _prevTriangleSlotCursor = 0;
+
     // stats
     unsigned int _drawnBatches = 0;
     unsigned int _drawnVertices = 0;
+    unsigned int _reusedVertices = 0;
     //the flag for checking whether renderer is rendering
     bool _isRendering = false;
     bool _isDepthTestFor2D = false;
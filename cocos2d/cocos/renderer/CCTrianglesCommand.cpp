@@ -47,6 +47,7 @@ void TrianglesCommand::init(float globalOrder, Texture2D* texture, const BlendFu
         CCLOGERROR("Resize indexCount from %d to %d, size must be multiple times of 3", count, _triangles.indexCount);
     }
     _mv = mv;
+    _vertexVersion = 0;
 
     if (_programType != _pipelineDescriptor.programState->getProgram()->getProgramType() ||
         _texture != texture->getBackendTexture() ||
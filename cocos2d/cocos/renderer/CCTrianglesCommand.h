@@ -98,6 +98,16 @@ public:
     const unsigned short* getIndices() const { return _triangles.indices; }
     /**Get the model view matrix.*/
     const Mat4& getModelView() const { return _mv; }
+
+    /**
+     Set the version of the vertex data and model view matrix, called after init().
+     The renderer keeps the batched vertices of the previous frame when the command comes back
+     at the same place with the same version, so the owner must pass a new version whenever
+     the vertices, the indices or the matrix change. 0, the value set by init(), disables the reuse.
+     */
+    void setVertexVersion(uint32_t version) { _vertexVersion = version; }
+    /**Get the version set by setVertexVersion().*/
+    uint32_t getVertexVersion() const { return _vertexVersion; }
     
     /** update material ID */
     void updateMaterialID();
@@ -113,6 +123,8 @@ protected:
     Triangles _triangles;
     /**Model view matrix when rendering the triangles.*/
     Mat4 _mv;
+    /**Version of the vertex data and model view matrix, 0 if unknown.*/
+    uint32_t _vertexVersion = 0;
 
     uint8_t _alphaTextureID = 0; // ANDROID ETC1 ALPHA supports.
 
@@ -0,0 +1,161 @@
+/****************************************************************************
+ Copyright (c) 2018-2019 Xiamen Yaji Software Co., Ltd.
+
+ http://www.cocos2d-x.org
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+ ****************************************************************************/
+
+#include "CommandBufferNull.h"
+#include "BufferNull.h"
+#include "RenderPipelineNull.h"
+#include "DeviceNull.h"
+#include "../ProgramState.h"
+#include "base/ccMacros.h"
+
+#include <cassert>
+#include <vector>
+
+CC_BACKEND_BEGIN
+
+CommandBufferNull::~CommandBufferNull()
+{
+    CC_SAFE_RELEASE_NULL(_renderPipeline);
+
+    cleanResources();
+}
+
+void CommandBufferNull::beginFrame()
+{
+    ++DeviceNull::getStatistics().frames;
+}
+
+void CommandBufferNull::beginRenderPass(const RenderPassDescriptor& descriptor)
+{
+    ++DeviceNull::getStatistics().renderPasses;
+}
+
+void CommandBufferNull::setRenderPipeline(RenderPipeline* renderPipeline)
+{
+    assert(renderPipeline != nullptr);
+    if (renderPipeline == nullptr)
+        return;
+
+    RenderPipelineNull* rp = static_cast<RenderPipelineNull*>(renderPipeline);
+    rp->retain();
+    CC_SAFE_RELEASE(_renderPipeline);
+    _renderPipeline = rp;
+}
+
+void CommandBufferNull::setViewport(int x, int y, unsigned int w, unsigned int h)
+{
+    _viewPort.x = x;
+    _viewPort.y = y;
+    _viewPort.w = w;
+    _viewPort.h = h;
+}
+
+void CommandBufferNull::setIndexBuffer(Buffer* buffer)
+{
+    assert(buffer != nullptr);
+    if (buffer == nullptr)
+        return;
+
+    buffer->retain();
+    CC_SAFE_RELEASE(_indexBuffer);
+    _indexBuffer = static_cast<BufferNull*>(buffer);
+}
+
+void CommandBufferNull::setVertexBuffer(Buffer* buffer)
+{
+    assert(buffer != nullptr);
+    if (buffer == nullptr)
+        return;
+
+    buffer->retain();
+    CC_SAFE_RELEASE(_vertexBuffer);
+    _vertexBuffer = static_cast<BufferNull*>(buffer);
+}
+
+void CommandBufferNull::setProgramState(ProgramState* programState)
+{
+    CC_SAFE_RETAIN(programState);
+    CC_SAFE_RELEASE(_programState);
+    _programState = programState;
+}
+
+void CommandBufferNull::drawArrays(PrimitiveType primitiveType, std::size_t start,  std::size_t count)
+{
+    prepareDrawing();
+
+    auto& statistics = DeviceNull::getStatistics();
+    ++statistics.drawCalls;
+    statistics.drawnVertices += count;
+
+    cleanResources();
+}
+
+void CommandBufferNull::drawElements(PrimitiveType primitiveType, IndexFormat indexType, std::size_t count, std::size_t offset)
+{
+    prepareDrawing();
+
+    auto& statistics = DeviceNull::getStatistics();
+    ++statistics.drawCalls;
+    statistics.drawnIndices += count;
+
+    cleanResources();
+}
+
+void CommandBufferNull::prepareDrawing() const
+{
+    if (!_programState)
+        return;
+
+    // uniform callbacks may update other uniforms, run them as the GL backend does
+    for (auto &cb : _programState->getCallbackUniforms())
+    {
+        cb.second(_programState, cb.first);
+    }
+
+    std::size_t bufferSize = 0;
+    char* buffer = nullptr;
+    _programState->getVertexUniformBuffer(&buffer, bufferSize);
+
+    auto& statistics = DeviceNull::getStatistics();
+    statistics.uniformBytes += bufferSize;
+    for (const auto& iter : _programState->getVertexTextureInfos())
+    {
+        statistics.textureBindings += iter.second.textures.size();
+    }
+}
+
+void CommandBufferNull::cleanResources()
+{
+    CC_SAFE_RELEASE_NULL(_indexBuffer);
+    CC_SAFE_RELEASE_NULL(_programState);
+    CC_SAFE_RELEASE_NULL(_vertexBuffer);
+}
+
+void CommandBufferNull::captureScreen(std::function<void(const unsigned char*, int, int)> callback)
+{
+    std::vector<unsigned char> buffer(_viewPort.w * _viewPort.h * 4, 0);
+    callback(buffer.data(), _viewPort.w, _viewPort.h);
+}
+
+CC_BACKEND_END
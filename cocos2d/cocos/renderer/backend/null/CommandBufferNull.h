@@ -0,0 +1,175 @@
+/****************************************************************************
+ Copyright (c) 2018-2019 Xiamen Yaji Software Co., Ltd.
+
+ http://www.cocos2d-x.org
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+ ****************************************************************************/
+
+#pragma once
+
+#include "../Macros.h"
+#include "../CommandBuffer.h"
+
+CC_BACKEND_BEGIN
+
+class BufferNull;
+class RenderPipelineNull;
+
+/**
+ * @addtogroup _null
+ * @{
+ */
+
+/**
+ * Accept rendering commands and count them in DeviceNull::getStatistics().
+ * Draw calls still run the uniform callbacks of the program state, as the OpenGL backend does,
+ * so the CPU work before a draw is the same as on a real device.
+ */
+class CommandBufferNull final : public CommandBuffer
+{
+public:
+    CommandBufferNull() = default;
+    ~CommandBufferNull();
+
+    /**
+     * Count a frame.
+     */
+    virtual void beginFrame() override;
+
+    /**
+     * Count a render pass.
+     * @param descriptor Specifies a group of render targets that hold the results of a render pass.
+     */
+    virtual void beginRenderPass(const RenderPassDescriptor& descriptor) override;
+
+    /**
+     * Sets the current render pipeline state object.
+     * @param renderPipeline An object that contains the graphics functions and configuration state used in a render pass.
+     */
+    virtual void setRenderPipeline(RenderPipeline* renderPipeline) override;
+
+    /**
+     * Fixed-function state
+     * @param x The x coordinate of the upper-left corner of the viewport.
+     * @param y The y coordinate of the upper-left corner of the viewport.
+     * @param w The width of the viewport, in pixels.
+     * @param h The height of the viewport, in pixels.
+     */
+    virtual void setViewport(int x, int y, unsigned int w, unsigned int h) override;
+
+    /**
+     * Ignore in the null backend.
+     */
+    virtual void setCullMode(CullMode mode) override {}
+
+    /**
+     * Ignore in the null backend.
+     */
+    virtual void setWinding(Winding winding) override {}
+
+    /**
+     * Set a global buffer for all vertex shaders at the given bind point index 0.
+     * @param buffer The vertex buffer to be setted in the buffer argument table.
+     */
+    virtual void setVertexBuffer(Buffer* buffer) override;
+
+    /**
+     * Set unifroms and textures
+     * @param programState A programState object that hold the uniform and texture data.
+     */
+    virtual void setProgramState(ProgramState* programState) override;
+
+    /**
+     * Set indexes when drawing primitives with index list
+     * @ buffer A buffer object that the device will read indexes from.
+     * @ see `drawElements(PrimitiveType primitiveType, IndexFormat indexType, unsigned int count, unsigned int offset)`
+     */
+    virtual void setIndexBuffer(Buffer* buffer) override;
+
+    /**
+     * Count a draw call and its vertices.
+     * @param primitiveType The type of primitives that elements are assembled into.
+     * @param start For each instance, the first index to draw
+     * @param count For each instance, the number of indexes to draw
+     */
+    virtual void drawArrays(PrimitiveType primitiveType, std::size_t start,  std::size_t count) override;
+
+    /**
+     * Count a draw call and its indices.
+     * @param primitiveType The type of primitives that elements are assembled into.
+     * @param indexType The type if indexes, either 16 bit integer or 32 bit integer.
+     * @param count The number of indexes to read from the index buffer for each instance.
+     * @param offset Byte offset within indexBuffer to start reading indexes from.
+     */
+    virtual void drawElements(PrimitiveType primitiveType, IndexFormat indexType, std::size_t count, std::size_t offset) override;
+
+    /**
+     * Do some resources release.
+     */
+    virtual void endRenderPass() override {}
+
+    /**
+     * Present a drawable and commit a command buffer so it can be executed as soon as possible.
+     */
+    virtual void endFrame() override {}
+
+    /**
+     * Ignore in the null backend.
+     */
+    virtual void setLineWidth(float lineWidth) override {}
+
+    /**
+     * Ignore in the null backend.
+     */
+    virtual void setScissorRect(bool isEnabled, float x, float y, float width, float height) override {}
+
+    /**
+     * Ignore in the null backend.
+     */
+    virtual void setDepthStencilState(DepthStencilState* depthStencilState) override {}
+
+    /**
+     * Get a screen snapshot, all pixels are zero.
+     * @param callback A callback to deal with screen snapshot image.
+     */
+    virtual void captureScreen(std::function<void(const unsigned char*, int, int)> callback) override;
+
+private:
+    struct Viewport
+    {
+        int x = 0;
+        int y = 0;
+        unsigned int w = 0;
+        unsigned int h = 0;
+    };
+
+    void prepareDrawing() const;
+    void cleanResources();
+
+    BufferNull* _vertexBuffer = nullptr;
+    ProgramState* _programState = nullptr;
+    BufferNull* _indexBuffer = nullptr;
+    RenderPipelineNull* _renderPipeline = nullptr;
+    Viewport _viewPort;
+};
+
+//end of _null group
+/// @}
+CC_BACKEND_END
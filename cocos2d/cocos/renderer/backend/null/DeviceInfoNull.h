@@ -0,0 +1,84 @@
+/****************************************************************************
+ Copyright (c) 2018-2019 Xiamen Yaji Software Co., Ltd.
+
+ http://www.cocos2d-x.org
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+ ****************************************************************************/
+
+#pragma once
+
+#include "../DeviceInfo.h"
+
+CC_BACKEND_BEGIN
+/**
+ * @addtogroup _null
+ * @{
+ */
+
+/**
+ * Fixed features and implementation limits of the null device.
+ * Limits match a typical desktop OpenGL driver so the engine takes the same code paths.
+ */
+class DeviceInfoNull: public DeviceInfo
+{
+public:
+    DeviceInfoNull() = default;
+    virtual ~DeviceInfoNull() = default;
+
+    /**
+     * Set the fixed implementation limits.
+     */
+    virtual bool init() override;
+
+    /**
+     * Get vendor device name.
+     * @return Vendor device name.
+     */
+    virtual const char* getVendor() const override;
+
+    /**
+     * Get the full name of the vendor device.
+     * @return The full name of the vendor device.
+     */
+    virtual const char* getRenderer() const override;
+
+    /**
+     * Get version name.
+     * @return Version name.
+     */
+    virtual const char* getVersion() const override;
+
+    /**
+     * Get extensions, always empty.
+     * @return Extension supported by device.
+     */
+    virtual const char* getExtension() const override;
+
+    /**
+     * Check if feature supported by the null device.
+     * Compressed texture formats are reported as unsupported, so they are decoded on the CPU like on a device without them.
+     * @param feature Specify feature to be query.
+     * @return true if the feature is supported, false otherwise.
+     */
+    virtual bool checkForFeatureSupported(FeatureType feature) override;
+};
+//end of _null group
+/// @}
+CC_BACKEND_END
@@ -0,0 +1,144 @@
+/****************************************************************************
+ Copyright (c) 2018-2019 Xiamen Yaji Software Co., Ltd.
+
+ http://www.cocos2d-x.org
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+ ****************************************************************************/
+
+#include "DeviceNull.h"
+#include "RenderPipelineNull.h"
+#include "BufferNull.h"
+#include "ShaderModuleNull.h"
+#include "CommandBufferNull.h"
+#include "TextureNull.h"
+#include "DepthStencilStateNull.h"
+#include "ProgramNull.h"
+#include "DeviceInfoNull.h"
+
+#include <cstdlib>
+#include <cstring>
+
+CC_BACKEND_BEGIN
+
+namespace
+{
+    bool s_selected = false;
+    NullStatistics s_statistics;
+}
+
+bool DeviceNull::isSelected()
+{
+#if CC_USE_NULL_RENDERER
+    return true;
+#else
+    if (s_selected)
+        return true;
+
+    const char* renderer = std::getenv("CC_RENDERER");
+    return renderer && std::strcmp(renderer, "null") == 0;
+#endif
+}
+
+void DeviceNull::select()
+{
+    s_selected = true;
+}
+
+NullStatistics& DeviceNull::getStatistics()
+{
+    return s_statistics;
+}
+
+void DeviceNull::resetStatistics()
+{
+    s_statistics = NullStatistics();
+}
+
+DeviceNull::DeviceNull()
+{
+    _deviceInfo = new (std::nothrow) DeviceInfoNull();
+    if(!_deviceInfo || _deviceInfo->init() == false)
+    {
+        delete _deviceInfo;
+        _deviceInfo = nullptr;
+    }
+}
+
+DeviceNull::~DeviceNull()
+{
+    ProgramCache::destroyInstance();
+    delete _deviceInfo;
+    _deviceInfo = nullptr;
+}
+
+CommandBuffer* DeviceNull::newCommandBuffer()
+{
+    return new (std::nothrow) CommandBufferNull();
+}
+
+Buffer* DeviceNull::newBuffer(std::size_t size, BufferType type, BufferUsage usage)
+{
+    ++s_statistics.buffersCreated;
+    s_statistics.bufferBytesAllocated += size;
+    return new (std::nothrow) BufferNull(size, type, usage);
+}
+
+TextureBackend* DeviceNull::newTexture(const TextureDescriptor& descriptor)
+{
+    switch (descriptor.textureType)
+    {
+    case TextureType::TEXTURE_2D:
+        ++s_statistics.texturesCreated;
+        return new (std::nothrow) Texture2DNull(descriptor);
+    case TextureType::TEXTURE_CUBE:
+        ++s_statistics.texturesCreated;
+        return new (std::nothrow) TextureCubeNull(descriptor);
+    default:
+        return nullptr;
+    }
+}
+
+ShaderModule* DeviceNull::newShaderModule(ShaderStage stage, const std::string& source)
+{
+    ++s_statistics.shaderModulesCreated;
+    return new (std::nothrow) ShaderModuleNull(stage, source);
+}
+
+DepthStencilState* DeviceNull::createDepthStencilState(const DepthStencilDescriptor& descriptor)
+{
+    auto ret = new (std::nothrow) DepthStencilStateNull(descriptor);
+    if (ret)
+        ret->autorelease();
+
+    return ret;
+}
+
+RenderPipeline* DeviceNull::newRenderPipeline()
+{
+    return new (std::nothrow) RenderPipelineNull();
+}
+
+Program* DeviceNull::newProgram(const std::string& vertexShader, const std::string& fragmentShader)
+{
+    ++s_statistics.programsCreated;
+    return new (std::nothrow) ProgramNull(vertexShader, fragmentShader);
+}
+
+CC_BACKEND_END
@@ -0,0 +1,155 @@
+/****************************************************************************
+ Copyright (c) 2018-2019 Xiamen Yaji Software Co., Ltd.
+
+ http://www.cocos2d-x.org
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+ ****************************************************************************/
+
+#pragma once
+
+#include "../Device.h"
+
+#include <cstdint>
+
+CC_BACKEND_BEGIN
+/**
+ * @addtogroup _null
+ * @{
+ */
+
+/**
+ * Counters collected by the null backend.
+ * No object of the null backend talks to a GPU; every entry point only updates these numbers,
+ * so they describe the work the renderer asked for.
+ */
+struct NullStatistics
+{
+    uint64_t frames = 0;                ///< CommandBuffer::beginFrame calls.
+    uint64_t renderPasses = 0;          ///< CommandBuffer::beginRenderPass calls.
+    uint64_t drawCalls = 0;             ///< drawArrays and drawElements calls.
+    uint64_t drawnVertices = 0;         ///< Vertices submitted by drawArrays.
+    uint64_t drawnIndices = 0;          ///< Indices submitted by drawElements.
+    uint64_t pipelineUpdates = 0;       ///< RenderPipeline::update calls.
+    uint64_t programChanges = 0;        ///< Pipeline updates that switched to another program.
+    uint64_t uniformBytes = 0;          ///< Uniform buffer bytes that would be uploaded at draw time.
+    uint64_t textureBindings = 0;       ///< Texture units that would be bound at draw time.
+    uint64_t buffersCreated = 0;
+    uint64_t bufferBytesAllocated = 0;
+    uint64_t bufferUploads = 0;         ///< Buffer::updateData and updateSubData calls.
+    uint64_t bufferBytesUploaded = 0;
+    uint64_t texturesCreated = 0;
+    uint64_t textureUploads = 0;        ///< Texture updateData, updateSubData and updateFaceData calls.
+    uint64_t textureBytesUploaded = 0;
+    uint64_t programsCreated = 0;
+    uint64_t shaderModulesCreated = 0;
+};
+
+/**
+ * A device that records what the renderer asks for and issues no graphics API call.
+ * Used for headless runs and for measuring the CPU side of rendering on machines without a GPU.
+ */
+class DeviceNull : public Device
+{
+public:
+    DeviceNull();
+    ~DeviceNull();
+
+    /**
+     * Whether Device::getInstance() creates the null device.
+     * True when the engine is built with CC_USE_NULL_RENDERER, when select() has been called,
+     * or when the environment variable CC_RENDERER is "null".
+     */
+    static bool isSelected();
+
+    /**
+     * Make Device::getInstance() create the null device.
+     * Must be called before anything creates the device, i.e. before Director::getInstance().
+     */
+    static void select();
+
+    /**
+     * Get the counters collected since startup or since the last resetStatistics().
+     * @return Counters of all null backend objects.
+     */
+    static NullStatistics& getStatistics();
+
+    /// Clear all counters.
+    static void resetStatistics();
+
+    /**
+     * New a CommandBuffer object, not auto released.
+     * @return A CommandBuffer object.
+     */
+    virtual CommandBuffer* newCommandBuffer() override;
+
+    /**
+     * New a Buffer object, not auto released.
+     * @param size Specifies the size in bytes of the buffer object's new data store.
+     * @param type Specifies the target buffer object. The symbolic constant must be BufferType::VERTEX or BufferType::INDEX.
+     * @param usage Specifies the expected usage pattern of the data store. The symbolic constant must be BufferUsage::STATIC, BufferUsage::DYNAMIC.
+     * @return A Buffer object.
+     */
+    virtual Buffer* newBuffer(std::size_t size, BufferType type, BufferUsage usage) override;
+
+    /**
+     * New a TextureBackend object, not auto released.
+     * @param descriptor Specifies texture description.
+     * @return A TextureBackend object.
+     */
+    virtual TextureBackend* newTexture(const TextureDescriptor& descriptor) override;
+
+    /**
+     * Create an auto released DepthStencilState object.
+     * @param descriptor Specifies depth and stencil description.
+     * @return An auto release DepthStencilState object.
+     */
+    virtual DepthStencilState* createDepthStencilState(const DepthStencilDescriptor& descriptor) override;
+
+    /**
+     * New a RenderPipeline object, not auto released.
+     * @return A RenderPipeline object.
+     */
+    virtual RenderPipeline* newRenderPipeline() override;
+
+    /**
+     * Ignore in the null backend.
+     */
+    virtual void setFrameBufferOnly(bool frameBufferOnly) override {}
+
+    /**
+     * New a Program, not auto released.
+     * @param vertexShader Specifes this is a vertex shader source.
+     * @param fragmentShader Specifes this is a fragment shader source.
+     * @return A Program instance.
+     */
+    virtual Program* newProgram(const std::string& vertexShader, const std::string& fragmentShader) override;
+
+protected:
+    /**
+     * New a shaderModule, not auto released.
+     * @param stage Specifies whether is vertex shader or fragment shader.
+     * @param source Specifies shader source.
+     * @return A ShaderModule object.
+     */
+    virtual ShaderModule* newShaderModule(ShaderStage stage, const std::string& source) override;
+};
+//end of _null group
+/// @}
+CC_BACKEND_END
@@ -0,0 +1,353 @@
+/****************************************************************************
+ Copyright (c) 2018-2019 Xiamen Yaji Software Co., Ltd.
+
+ http://www.cocos2d-x.org
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+ ****************************************************************************/
+
+#include "ProgramNull.h"
+#include "ShaderModuleNull.h"
+#include "renderer/backend/Types.h"
+#include "base/ccMacros.h"
+#include "platform/CCGL.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <sstream>
+
+CC_BACKEND_BEGIN
+
+namespace
+{
+    struct TypeInfoNull
+    {
+        const char* name;
+        unsigned int type;  ///< The GL enum glGetActiveUniform/glGetActiveAttrib would report.
+        unsigned int size;  ///< Same as UtilsGL::getGLDataTypeSize; samplers take no room in the uniform buffer.
+    };
+
+    const TypeInfoNull TYPE_INFOS[] = {
+        { "float",       GL_FLOAT,        4 },
+        { "vec2",        GL_FLOAT_VEC2,   8 },
+        { "vec3",        GL_FLOAT_VEC3,   12 },
+        { "vec4",        GL_FLOAT_VEC4,   16 },
+        { "int",         GL_INT,          4 },
+        { "ivec2",       GL_INT_VEC2,     8 },
+        { "ivec3",       GL_INT_VEC3,     12 },
+        { "ivec4",       GL_INT_VEC4,     16 },
+        { "bool",        GL_BOOL,         1 },
+        { "bvec2",       GL_BOOL_VEC2,    2 },
+        { "bvec3",       GL_BOOL_VEC3,    1 },
+        { "bvec4",       GL_BOOL_VEC4,    4 },
+        { "mat2",        GL_FLOAT_MAT2,   16 },
+        { "mat3",        GL_FLOAT_MAT3,   36 },
+        { "mat4",        GL_FLOAT_MAT4,   64 },
+        { "sampler2D",   GL_SAMPLER_2D,   0 },
+        { "samplerCube", GL_SAMPLER_CUBE, 0 },
+    };
+
+    const TypeInfoNull* findTypeInfo(const std::string& name)
+    {
+        for (const auto& info : TYPE_INFOS)
+        {
+            if (name == info.name)
+                return &info;
+        }
+        return nullptr;
+    }
+
+    bool isPrecisionQualifier(const std::string& token)
+    {
+        return token == "lowp" || token == "mediump" || token == "highp";
+    }
+
+    /// Remove // and /* */ comments.
+    std::string stripComments(const std::string& source)
+    {
+        std::string result;
+        result.reserve(source.size());
+        for (std::size_t i = 0; i < source.size(); ++i)
+        {
+            if (source[i] == '/' && i + 1 < source.size() && source[i + 1] == '/')
+            {
+                i = source.find('\n', i);
+                if (i == std::string::npos)
+                    break;
+                result += '\n';
+            }
+            else if (source[i] == '/' && i + 1 < source.size() && source[i + 1] == '*')
+            {
+                i = source.find("*/", i + 2);
+                if (i == std::string::npos)
+                    break;
+                ++i;
+                result += ' ';
+            }
+            else
+            {
+                result += source[i];
+            }
+        }
+        return result;
+    }
+
+    /// Evaluate an array size: an integer literal, or a `#define`d integer (3D shaders size light arrays that way).
+    int evaluateArraySize(std::string expression, const std::unordered_map<std::string, int>& defines)
+    {
+        expression.erase(std::remove_if(expression.begin(), expression.end(), ::isspace), expression.end());
+        if (expression.empty())
+            return 1;
+
+        if (std::isdigit(static_cast<unsigned char>(expression[0])))
+            return std::max(1, std::atoi(expression.c_str()));
+
+        auto iter = defines.find(expression);
+        return iter != defines.end() ? std::max(1, iter->second) : 1;
+    }
+}
+
+ProgramNull::ProgramNull(const std::string& vertexShader, const std::string& fragmentShader)
+: Program(vertexShader, fragmentShader)
+{
+    _vertexShaderModule = static_cast<ShaderModuleNull*>(ShaderCache::newVertexShaderModule(_vertexShader));
+    _fragmentShaderModule = static_cast<ShaderModuleNull*>(ShaderCache::newFragmentShaderModule(_fragmentShader));
+
+    CC_SAFE_RETAIN(_vertexShaderModule);
+    CC_SAFE_RETAIN(_fragmentShaderModule);
+
+    // uniforms declared in both stages are one uniform, as after linking
+    reflectSource(_vertexShader, true);
+    reflectSource(_fragmentShader, false);
+    computeLocations();
+}
+
+ProgramNull::~ProgramNull()
+{
+    CC_SAFE_RELEASE(_vertexShaderModule);
+    CC_SAFE_RELEASE(_fragmentShaderModule);
+}
+
+void ProgramNull::reflectSource(const std::string& source, bool isVertexShader)
+{
+    std::unordered_map<std::string, int> defines;
+    std::string declarations;
+
+    // preprocessor lines are dropped, both sides of `#ifdef GL_ES` are kept and deduplicated by name
+    std::istringstream lines(stripComments(source));
+    std::string line;
+    while (std::getline(lines, line))
+    {
+        auto first = line.find_first_not_of(" \t\r");
+        if (first != std::string::npos && line[first] == '#')
+        {
+            std::istringstream directive(line.substr(first + 1));
+            std::string keyword, name, value;
+            directive >> keyword >> name >> value;
+            if (keyword == "define" && !value.empty() && std::isdigit(static_cast<unsigned char>(value[0])))
+                defines[name] = std::atoi(value.c_str());
+            continue;
+        }
+        declarations += line;
+        declarations += '\n';
+    }
+
+    std::size_t start = 0;
+    while (start < declarations.size())
+    {
+        auto end = declarations.find(';', start);
+        if (end == std::string::npos)
+            end = declarations.size();
+        std::string statement = declarations.substr(start, end - start);
+        start = end + 1;
+
+        // a statement may follow the closing brace of a function
+        auto brace = statement.find_last_of("{}");
+        if (brace != std::string::npos)
+            statement = statement.substr(brace + 1);
+
+        std::istringstream tokens(statement);
+        std::string storage;
+        tokens >> storage;
+        bool isUniform = storage == "uniform";
+        bool isAttribute = isVertexShader && storage == "attribute";
+        if (!isUniform && !isAttribute)
+            continue;
+
+        std::string type;
+        while (tokens >> type && isPrecisionQualifier(type))
+            ;
+
+        // the rest is a comma separated list of names with optional array sizes
+        std::string names;
+        std::getline(tokens, names, '\0');
+        std::istringstream list(names);
+        std::string declarator;
+        while (std::getline(list, declarator, ','))
+        {
+            std::string name = declarator;
+            int count = 1;
+            bool isArray = false;
+            auto bracket = declarator.find('[');
+            if (bracket != std::string::npos)
+            {
+                auto close = declarator.find(']', bracket);
+                count = evaluateArraySize(declarator.substr(bracket + 1, close == std::string::npos ? std::string::npos : close - bracket - 1), defines);
+                isArray = true;
+                name = declarator.substr(0, bracket);
+            }
+            name.erase(std::remove_if(name.begin(), name.end(), ::isspace), name.end());
+            if (name.empty())
+                continue;
+
+            if (isUniform)
+                addUniform(type, name, count, isArray);
+            else
+                addAttribute(type, name);
+        }
+    }
+}
+
+void ProgramNull::addUniform(const std::string& type, const std::string& name, int count, bool isArray)
+{
+    if (_activeUniformInfos.find(name) != _activeUniformInfos.end())
+        return;
+
+    const auto* typeInfo = findTypeInfo(type);
+    if (!typeInfo)
+    {
+        CCLOG("cocos2d: %s: unsupported uniform type %s of %s", __FUNCTION__, type.c_str(), name.c_str());
+        return;
+    }
+
+    UniformInfo uniform;
+    uniform.count = count;
+    uniform.type = typeInfo->type;
+    uniform.isArray = isArray;
+    uniform.location = static_cast<int>(_activeUniformInfos.size());
+    uniform.size = typeInfo->size;
+    uniform.bufferOffset = (uniform.size == 0) ? 0 : _totalBufferSize;
+    _activeUniformInfos[name] = uniform;
+    _totalBufferSize += uniform.size * uniform.count;
+    _maxLocation = _maxLocation <= uniform.location ? (uniform.location + 1) : _maxLocation;
+}
+
+void ProgramNull::addAttribute(const std::string& type, const std::string& name)
+{
+    if (_activeAttributes.find(name) != _activeAttributes.end())
+        return;
+
+    const auto* typeInfo = findTypeInfo(type);
+    AttributeBindInfo info;
+    info.attributeName = name;
+    info.location = static_cast<int>(_activeAttributes.size());
+    info.type = typeInfo ? typeInfo->type : 0;
+    info.size = typeInfo ? typeInfo->size : 0;
+    _activeAttributes[name] = info;
+}
+
+void ProgramNull::computeLocations()
+{
+    std::fill(_builtinAttributeLocation, _builtinAttributeLocation + ATTRIBUTE_MAX, -1);
+
+    _builtinAttributeLocation[Attribute::POSITION] = getAttributeLocation(ATTRIBUTE_NAME_POSITION);
+    _builtinAttributeLocation[Attribute::COLOR] = getAttributeLocation(ATTRIBUTE_NAME_COLOR);
+    _builtinAttributeLocation[Attribute::TEXCOORD] = getAttributeLocation(ATTRIBUTE_NAME_TEXCOORD);
+
+    _builtinUniformLocation[Uniform::MVP_MATRIX] = getUniformLocation(UNIFORM_NAME_MVP_MATRIX);
+    _builtinUniformLocation[Uniform::TEXT_COLOR] = getUniformLocation(UNIFORM_NAME_TEXT_COLOR);
+    _builtinUniformLocation[Uniform::EFFECT_COLOR] = getUniformLocation(UNIFORM_NAME_EFFECT_COLOR);
+    _builtinUniformLocation[Uniform::EFFECT_TYPE] = getUniformLocation(UNIFORM_NAME_EFFECT_TYPE);
+
+    // the GL backend only sets the location of samplers, not their (meaningless) buffer offset
+    _builtinUniformLocation[Uniform::TEXTURE].location[0] = getUniformLocation(UNIFORM_NAME_TEXTURE).location[0];
+    _builtinUniformLocation[Uniform::TEXTURE1].location[0] = getUniformLocation(UNIFORM_NAME_TEXTURE1).location[0];
+}
+
+int ProgramNull::getAttributeLocation(Attribute name) const
+{
+    return _builtinAttributeLocation[name];
+}
+
+int ProgramNull::getAttributeLocation(const std::string& name) const
+{
+    auto iter = _activeAttributes.find(name);
+    return iter != _activeAttributes.end() ? iter->second.location : -1;
+}
+
+const std::unordered_map<std::string, AttributeBindInfo> ProgramNull::getActiveAttributes() const
+{
+    return _activeAttributes;
+}
+
+UniformLocation ProgramNull::getUniformLocation(backend::Uniform name) const
+{
+    return _builtinUniformLocation[name];
+}
+
+UniformLocation ProgramNull::getUniformLocation(const std::string& uniform) const
+{
+    UniformLocation uniformLocation;
+    auto iter = _activeUniformInfos.find(uniform);
+    if (iter != _activeUniformInfos.end())
+    {
+        uniformLocation.location[0] = iter->second.location;
+        uniformLocation.location[1] = iter->second.bufferOffset;
+    }
+    return uniformLocation;
+}
+
+int ProgramNull::getMaxVertexLocation() const
+{
+    return _maxLocation;
+}
+
+int ProgramNull::getMaxFragmentLocation() const
+{
+    return _maxLocation;
+}
+
+#if CC_ENABLE_CACHE_TEXTURE_DATA
+const std::unordered_map<std::string, int> ProgramNull::getAllUniformsLocation() const
+{
+    std::unordered_map<std::string, int> locations;
+    for (const auto& uniform : _activeUniformInfos)
+        locations[uniform.first] = uniform.second.location;
+    return locations;
+}
+#endif
+
+const UniformInfo& ProgramNull::getActiveUniformInfo(ShaderStage stage, int location) const
+{
+    static const UniformInfo EMPTY_UNIFORM_INFO;
+    return EMPTY_UNIFORM_INFO;
+}
+
+const std::unordered_map<std::string, UniformInfo>& ProgramNull::getAllActiveUniformInfo(ShaderStage stage) const
+{
+    return _activeUniformInfos;
+}
+
+std::size_t ProgramNull::getUniformBufferSize(ShaderStage stage) const
+{
+    return _totalBufferSize;
+}
+
+CC_BACKEND_END
@@ -0,0 +1,146 @@
+/****************************************************************************
+ Copyright (c) 2018-2019 Xiamen Yaji Software Co., Ltd.
+
+ http://www.cocos2d-x.org
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+ ****************************************************************************/
+
+#pragma once
+
+#include "../Program.h"
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+CC_BACKEND_BEGIN
+
+class ShaderModuleNull;
+/**
+ * @addtogroup _null
+ * @{
+ */
+
+/**
+ * A program that is never compiled or linked.
+ * Uniforms and vertex attributes are reflected from the `uniform` and `attribute` declarations of the GLSL sources,
+ * with the same sizes, buffer offsets and builtin locations as the OpenGL backend, so ProgramState works unchanged.
+ */
+class ProgramNull : public Program
+{
+public:
+    /**
+     * @param vertexShader Specifes the vertex shader source.
+     * @param fragmentShader Specifes the fragment shader source.
+     */
+    ProgramNull(const std::string& vertexShader, const std::string& fragmentShader);
+    ~ProgramNull();
+
+    /**
+     * Get uniform location by name.
+     * @param uniform Specifies the uniform name.
+     * @return The uniform location.
+     */
+    virtual UniformLocation getUniformLocation(const std::string& uniform) const override;
+
+    /**
+     * Get uniform location by engine built-in uniform enum name.
+     * @param name Specifies the engine built-in uniform enum name.
+     * @return The uniform location.
+     */
+    virtual UniformLocation getUniformLocation(backend::Uniform name) const override;
+
+    /**
+     * Get attribute location by attribute name.
+     * @param name Specifies the attribute name.
+     * @return The attribute location, -1 if the vertex shader does not declare it.
+     */
+    virtual int getAttributeLocation(const std::string& name) const override;
+
+    /**
+     * Get attribute location by engine built-in attribute enum name.
+     * @param name Specifies the engine built-in attribute enum name.
+     * @return The attribute location.
+     */
+    virtual int getAttributeLocation(Attribute name) const override;
+
+    /**
+     * Get maximum vertex location.
+     * @return Maximum vertex locaiton.
+     */
+    virtual int getMaxVertexLocation() const override;
+
+    /**
+     * Get maximum fragment location.
+     * @return Maximum fragment location.
+     */
+    virtual int getMaxFragmentLocation() const override;
+
+    /**
+     * Get active vertex attributes.
+     * @return Active vertex attributes. key is active attribute name, Value is corresponding attribute info.
+     */
+    virtual const std::unordered_map<std::string, AttributeBindInfo> getActiveAttributes() const override;
+
+    /**
+     * Get uniform buffer size in bytes that can hold all the uniforms.
+     * @param stage Specifies the shader stage. The symbolic constant can be either VERTEX or FRAGMENT.
+     * @return The uniform buffer size in bytes.
+     */
+    virtual std::size_t getUniformBufferSize(ShaderStage stage) const override;
+
+    /**
+     * Get a uniformInfo in given location from the specific shader stage.
+     * @param stage Specifies the shader stage. The symbolic constant can be either VERTEX or FRAGMENT.
+     * @param location Specifies the uniform locaion.
+     * @return The uniformInfo.
+     */
+    virtual const UniformInfo& getActiveUniformInfo(ShaderStage stage, int location) const override;
+
+    /**
+     * Get all uniformInfos.
+     * @return The uniformInfos.
+     */
+    virtual const std::unordered_map<std::string, UniformInfo>& getAllActiveUniformInfo(ShaderStage stage) const override;
+
+private:
+    void reflectSource(const std::string& source, bool isVertexShader);
+    void addUniform(const std::string& type, const std::string& name, int count, bool isArray);
+    void addAttribute(const std::string& type, const std::string& name);
+    void computeLocations();
+#if CC_ENABLE_CACHE_TEXTURE_DATA
+    virtual int getMappedLocation(int location) const override { return location; }
+    virtual int getOriginalLocation(int location) const override { return location; }
+    virtual const std::unordered_map<std::string, int> getAllUniformsLocation() const override;
+#endif
+
+    ShaderModuleNull* _vertexShaderModule = nullptr;
+    ShaderModuleNull* _fragmentShaderModule = nullptr;
+
+    std::unordered_map<std::string, UniformInfo> _activeUniformInfos;
+    std::unordered_map<std::string, AttributeBindInfo> _activeAttributes;
+    std::size_t _totalBufferSize = 0;
+    int _maxLocation = -1;
+    UniformLocation _builtinUniformLocation[UNIFORM_MAX];
+    int _builtinAttributeLocation[Attribute::ATTRIBUTE_MAX];
+};
+//end of _null group
+/// @}
+CC_BACKEND_END
@@ -0,0 +1,51 @@
+/****************************************************************************
+ Copyright (c) 2018-2019 Xiamen Yaji Software Co., Ltd.
+
+ http://www.cocos2d-x.org
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+ ****************************************************************************/
+
+#include "RenderPipelineNull.h"
+#include "ProgramNull.h"
+#include "DeviceNull.h"
+#include "../ProgramState.h"
+
+CC_BACKEND_BEGIN
+
+void RenderPipelineNull::update(const PipelineDescriptor& pipelineDescirptor, const RenderPassDescriptor& renderpassDescriptor)
+{
+    auto& statistics = DeviceNull::getStatistics();
+    ++statistics.pipelineUpdates;
+
+    if(_programNull != pipelineDescirptor.programState->getProgram())
+    {
+        CC_SAFE_RELEASE(_programNull);
+        _programNull = static_cast<ProgramNull*>(pipelineDescirptor.programState->getProgram());
+        CC_SAFE_RETAIN(_programNull);
+        ++statistics.programChanges;
+    }
+}
+
+RenderPipelineNull::~RenderPipelineNull()
+{
+    CC_SAFE_RELEASE(_programNull);
+}
+
+CC_BACKEND_END
@@ -0,0 +1,125 @@
+/****************************************************************************
+ Copyright (c) 2018-2019 Xiamen Yaji Software Co., Ltd.
+
+ http://www.cocos2d-x.org
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+ ****************************************************************************/
+
+#include "TextureNull.h"
+#include "DeviceNull.h"
+
+#include <vector>
+
+CC_BACKEND_BEGIN
+
+namespace
+{
+    void countUpload(std::size_t bytes)
+    {
+        auto& statistics = DeviceNull::getStatistics();
+        ++statistics.textureUploads;
+        statistics.textureBytesUploaded += bytes;
+    }
+
+    void readZeroedPixels(std::size_t width, std::size_t height, std::function<void(const unsigned char*, std::size_t, std::size_t)> callback)
+    {
+        // same layout as the GL backend's glReadPixels: tightly packed RGBA
+        std::vector<unsigned char> image(width * height * 4, 0);
+        callback(image.data(), width, height);
+    }
+}
+
+Texture2DNull::Texture2DNull(const TextureDescriptor& descriptor)
+: Texture2DBackend(descriptor)
+{
+}
+
+void Texture2DNull::updateData(uint8_t* data, std::size_t width , std::size_t height, std::size_t level)
+{
+    countUpload(width * height * _bitsPerElement / 8);
+
+    if(!_hasMipmaps && level > 0)
+        _hasMipmaps = true;
+}
+
+void Texture2DNull::updateCompressedData(uint8_t *data, std::size_t width, std::size_t height,
+                                         std::size_t dataLen, std::size_t level)
+{
+    countUpload(dataLen);
+
+    if(!_hasMipmaps && level > 0)
+        _hasMipmaps = true;
+}
+
+void Texture2DNull::updateSubData(std::size_t xoffset, std::size_t yoffset, std::size_t width, std::size_t height, std::size_t level, uint8_t* data)
+{
+    countUpload(width * height * _bitsPerElement / 8);
+
+    if(!_hasMipmaps && level > 0)
+        _hasMipmaps = true;
+}
+
+void Texture2DNull::updateCompressedSubData(std::size_t xoffset, std::size_t yoffset, std::size_t width,
+                                            std::size_t height, std::size_t dataLen, std::size_t level,
+                                            uint8_t *data)
+{
+    countUpload(dataLen);
+
+    if(!_hasMipmaps && level > 0)
+        _hasMipmaps = true;
+}
+
+void Texture2DNull::getBytes(std::size_t x, std::size_t y, std::size_t width, std::size_t height, bool flipImage, std::function<void(const unsigned char*, std::size_t, std::size_t)> callback)
+{
+    readZeroedPixels(width, height, callback);
+}
+
+void Texture2DNull::generateMipmaps()
+{
+    if (TextureUsage::RENDER_TARGET == _textureUsage)
+        return;
+
+    _hasMipmaps = true;
+}
+
+TextureCubeNull::TextureCubeNull(const TextureDescriptor& descriptor)
+: TextureCubemapBackend(descriptor)
+{
+}
+
+void TextureCubeNull::updateFaceData(TextureCubeFace side, void *data)
+{
+    countUpload(_width * _height * _bitsPerElement / 8);
+}
+
+void TextureCubeNull::getBytes(std::size_t x, std::size_t y, std::size_t width, std::size_t height, bool flipImage, std::function<void(const unsigned char*, std::size_t, std::size_t)> callback)
+{
+    readZeroedPixels(width, height, callback);
+}
+
+void TextureCubeNull::generateMipmaps()
+{
+    if (TextureUsage::RENDER_TARGET == _textureUsage)
+        return;
+
+    _hasMipmaps = true;
+}
+
+CC_BACKEND_END
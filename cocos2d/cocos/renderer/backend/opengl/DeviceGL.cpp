@@ -32,12 +32,23 @@
 #include "ProgramGL.h"
 #include "DeviceInfoGL.h"
 
+#if CC_ENABLE_NULL_RENDERER
+#include "../null/DeviceNull.h"
+#endif
+
 CC_BACKEND_BEGIN
 
 Device* Device::getInstance()
 {
     if (!_instance)
+    {
+#if CC_ENABLE_NULL_RENDERER
+        if (DeviceNull::isSelected())
+            _instance = new (std::nothrow) DeviceNull();
+        else
+#endif
         _instance = new (std::nothrow) DeviceGL();
+    }
     
     return _instance;
 }
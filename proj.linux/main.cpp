@@ -26,14 +26,122 @@
 
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
 #include <unistd.h>
+#include <algorithm>
 #include <string>
+#include <vector>
+
+#if CC_ENABLE_NULL_RENDERER
+#include "../Classes/controllers/GameController.h"
+#include "platform/headless/CCGLViewHeadless.h"
+#include "renderer/backend/null/DeviceNull.h"
+#endif
 
 USING_NS_CC;
 
+#if CC_ENABLE_NULL_RENDERER
+// Percentile of an ascending sorted sample
+static double percentile(const std::vector<double>& sorted, double p)
+{
+    if (sorted.empty()) return 0.0;
+    size_t index = (size_t)(p * (sorted.size() - 1) + 0.5);
+    return sorted[std::min(index, sorted.size() - 1)];
+}
+
+// Run the game on the null rendering backend without a window and print per-frame cost as JSON.
+// The first warmupFrames frames (texture decoding, scene creation) are not measured.
+static int runHeadless(unsigned int warmupFrames, unsigned int frames, int levelId)
+{
+    backend::DeviceNull::select();
+
+    auto director = Director::getInstance();
+    auto glview = GLViewHeadless::create("Solitaire", Size(540, 1040));
+    director->setOpenGLView(glview);
+
+    if (!Application::getInstance()->applicationDidFinishLaunching())
+        return 1;
+
+    if (levelId > 0)
+    {
+        auto scene = GameController::createGameScene(levelId);
+        if (!scene)
+        {
+            fprintf(stderr, "level %d could not be loaded\n", levelId);
+            return 1;
+        }
+        director->replaceScene(scene);
+    }
+
+    glview->runFrames(warmupFrames);
+    backend::DeviceNull::resetStatistics();
+    auto measuredFrom = glview->getFrameTimes().size();
+    auto drawnFrames = glview->runFrames(frames);
+
+    std::vector<double> times(glview->getFrameTimes().begin() + measuredFrom, glview->getFrameTimes().end());
+    double total = 0.0;
+    for (double t : times) total += t;
+    std::sort(times.begin(), times.end());
+
+    const auto& stats = backend::DeviceNull::getStatistics();
+    double perFrame = drawnFrames ? 1.0 / drawnFrames : 0.0;
+    printf("{\n");
+    printf("  \"level\": %d,\n", levelId);
+    printf("  \"warmup_frames\": %u,\n", warmupFrames);
+    printf("  \"frames\": %u,\n", drawnFrames);
+    printf("  \"frame_ms\": { \"mean\": %.4f, \"p50\": %.4f, \"p95\": %.4f, \"max\": %.4f },\n",
+        times.empty() ? 0.0 : total / times.size(), percentile(times, 0.5), percentile(times, 0.95),
+        times.empty() ? 0.0 : times.back());
+    printf("  \"per_frame\": { \"draw_calls\": %.2f, \"vertices\": %.2f, \"indices\": %.2f, "
+        "\"buffer_bytes\": %.1f, \"uniform_bytes\": %.1f, \"texture_bindings\": %.2f, \"pipeline_updates\": %.2f },\n",
+        stats.drawCalls * perFrame, stats.drawnVertices * perFrame, stats.drawnIndices * perFrame,
+        stats.bufferBytesUploaded * perFrame, stats.uniformBytes * perFrame,
+        stats.textureBindings * perFrame, stats.pipelineUpdates * perFrame);
+    printf("  \"totals\": { \"render_passes\": %llu, \"buffers_created\": %llu, \"textures_created\": %llu, "
+        "\"texture_bytes\": %llu, \"programs_created\": %llu }\n",
+        (unsigned long long)stats.renderPasses, (unsigned long long)stats.buffersCreated,
+        (unsigned long long)stats.texturesCreated, (unsigned long long)stats.textureBytesUploaded,
+        (unsigned long long)stats.programsCreated);
+    printf("}\n");
+
+    // same shutdown as Application::run
+    director->end();
+    director->mainLoop();
+    return 0;
+}
+#endif
+
 int main(int argc, char **argv)
 {
     // create the application instance
     AppDelegate app;
+
+    // --headless [--frames N] [--warmup N] [--level ID]: render N frames on the null backend and print timings
+    bool headless = false;
+#if CC_ENABLE_NULL_RENDERER
+    unsigned int frames = 600;
+    unsigned int warmupFrames = 60;
+    int levelId = 0;
+#endif
+    for (int i = 1; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "--headless") == 0) headless = true;
+#if CC_ENABLE_NULL_RENDERER
+        else if (strcmp(argv[i], "--frames") == 0 && i + 1 < argc) frames = (unsigned int)atoi(argv[++i]);
+        else if (strcmp(argv[i], "--warmup") == 0 && i + 1 < argc) warmupFrames = (unsigned int)atoi(argv[++i]);
+        else if (strcmp(argv[i], "--level") == 0 && i + 1 < argc) levelId = atoi(argv[++i]);
+#endif
+    }
+
+    if (headless)
+    {
+#if CC_ENABLE_NULL_RENDERER
+        return runHeadless(warmupFrames, frames, levelId);
+#else
+        fprintf(stderr, "--headless needs the engine built with -DCC_ENABLE_NULL_RENDERER=ON\n");
+        return 1;
+#endif
+    }
+
     return Application::getInstance()->run();
 }
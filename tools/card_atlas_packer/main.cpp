@@ -0,0 +1,275 @@
+/**
+ * @file main.cpp
+ * @brief card_atlas_packer 命令行工具
+ * 将一个目录下的所有卡牌 PNG 打包为一张图集纹理 + SpriteFrameCache 可直接加载的 plist 帧索引 (format 2)。
+ * 全部牌面共享同一纹理后，Renderer 可将整个桌面合并为一次绘制。
+ *
+ * 用法: card_atlas_packer [--padding N] <input_dir> <output_prefix>
+ *       生成 <output_prefix>.png 与 <output_prefix>.plist
+ */
+#include "cocos2d.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#include <direct.h>
+#define getcwd _getcwd
+#else
+#include <unistd.h>
+#endif
+
+USING_NS_CC;
+
+namespace {
+    const int kMaxAtlasSize = 4096;     ///< 低端设备可保证支持的最大纹理边长
+
+    /**
+     * @brief 单个待打包的帧 (RGBA8888，未预乘)
+     */
+    struct FrameImage {
+        std::string name;           ///< 帧名 (原文件名，如 card_clubs_02.png)
+        int width = 0;
+        int height = 0;
+        std::vector<unsigned char> pixels;
+        int x = 0;                  ///< 在图集中的位置 (不含外扩边)
+        int y = 0;
+    };
+
+    std::string toAbsolutePath(const std::string& path) {
+        if (FileUtils::getInstance()->isAbsolutePath(path)) return path;
+
+        char cwd[4096];
+        if (!getcwd(cwd, sizeof(cwd))) return path;
+        return std::string(cwd) + "/" + path;
+    }
+
+    std::string baseName(const std::string& path) {
+        size_t pos = path.find_last_of("/\\");
+        return pos == std::string::npos ? path : path.substr(pos + 1);
+    }
+
+    int nextPowerOfTwo(int value) {
+        int result = 1;
+        while (result < value) result <<= 1;
+        return result;
+    }
+
+    void printUsage() {
+        printf("Usage: card_atlas_packer [options] <input_dir> <output_prefix>\n");
+        printf("  --padding N   transparent gap between frames in pixels (default 2)\n");
+    }
+
+    bool loadFrame(const std::string& file, FrameImage& frame) {
+        Image* image = new (std::nothrow) Image();
+        if (!image || !image->initWithImageFile(file)) {
+            CC_SAFE_RELEASE(image);
+            return false;
+        }
+
+        frame.name = baseName(file);
+        frame.width = image->getWidth();
+        frame.height = image->getHeight();
+        frame.pixels.resize((size_t)frame.width * frame.height * 4);
+
+        // 调色板/RGB 图片统一展开为 RGBA
+        const unsigned char* src = image->getData();
+        bool hasAlpha = image->hasAlpha();
+        for (int i = 0; i < frame.width * frame.height; ++i) {
+            unsigned char* dst = &frame.pixels[(size_t)i * 4];
+            if (hasAlpha) {
+                memcpy(dst, src + (size_t)i * 4, 4);
+            }
+            else {
+                memcpy(dst, src + (size_t)i * 3, 3);
+                dst[3] = 255;
+            }
+        }
+
+        image->release();
+        return true;
+    }
+
+    /**
+     * @brief 按行 (shelf) 摆放帧
+     * @param atlasWidth 图集宽度
+     * @param padding 帧之间的间距 (含 1 像素外扩边)
+     * @return int 所需高度，放不下返回 -1
+     */
+    int layoutFrames(std::vector<FrameImage>& frames, int atlasWidth, int padding) {
+        int cursorX = padding;
+        int cursorY = padding;
+        int shelfHeight = 0;
+
+        for (auto& frame : frames) {
+            if (frame.width + padding * 2 > atlasWidth) return -1;
+            if (cursorX + frame.width + padding > atlasWidth) {
+                cursorX = padding;
+                cursorY += shelfHeight + padding;
+                shelfHeight = 0;
+            }
+            frame.x = cursorX;
+            frame.y = cursorY;
+            cursorX += frame.width + padding;
+            shelfHeight = std::max(shelfHeight, frame.height);
+        }
+        return cursorY + shelfHeight + padding;
+    }
+
+    /**
+     * @brief 将帧写入图集，并向四周外扩 1 像素
+     * 线性过滤采样到帧边缘时取到的是自身的边缘色，而不是相邻帧或透明色。
+     */
+    void blitFrame(std::vector<unsigned char>& atlas, int atlasWidth, int atlasHeight, const FrameImage& frame) {
+        for (int dy = -1; dy <= frame.height; ++dy) {
+            int ty = frame.y + dy;
+            if (ty < 0 || ty >= atlasHeight) continue;
+            int sy = std::min(std::max(dy, 0), frame.height - 1);
+
+            for (int dx = -1; dx <= frame.width; ++dx) {
+                int tx = frame.x + dx;
+                if (tx < 0 || tx >= atlasWidth) continue;
+                int sx = std::min(std::max(dx, 0), frame.width - 1);
+
+                memcpy(&atlas[((size_t)ty * atlasWidth + tx) * 4],
+                    &frame.pixels[((size_t)sy * frame.width + sx) * 4], 4);
+            }
+        }
+    }
+
+    std::string buildPlist(const std::vector<FrameImage>& frames, const std::string& textureName,
+        int atlasWidth, int atlasHeight) {
+        std::string plist;
+        plist += "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n";
+        plist += "<!DOCTYPE plist PUBLIC \"-//Apple//DTD PLIST 1.0//EN\" \"http://www.apple.com/DTDs/PropertyList-1.0.dtd\">\n";
+        plist += "<plist version=\"1.0\">\n<dict>\n";
+        plist += "    <key>frames</key>\n    <dict>\n";
+
+        for (const auto& frame : frames) {
+            plist += StringUtils::format("        <key>%s</key>\n        <dict>\n", frame.name.c_str());
+            plist += StringUtils::format("            <key>frame</key>\n            <string>{{%d,%d},{%d,%d}}</string>\n",
+                frame.x, frame.y, frame.width, frame.height);
+            plist += "            <key>offset</key>\n            <string>{0,0}</string>\n";
+            plist += "            <key>rotated</key>\n            <false/>\n";
+            plist += StringUtils::format("            <key>sourceColorRect</key>\n            <string>{{0,0},{%d,%d}}</string>\n",
+                frame.width, frame.height);
+            plist += StringUtils::format("            <key>sourceSize</key>\n            <string>{%d,%d}</string>\n",
+                frame.width, frame.height);
+            plist += "        </dict>\n";
+        }
+
+        plist += "    </dict>\n";
+        plist += "    <key>metadata</key>\n    <dict>\n";
+        plist += "        <key>format</key>\n        <integer>2</integer>\n";
+        plist += StringUtils::format("        <key>realTextureFileName</key>\n        <string>%s</string>\n", textureName.c_str());
+        plist += StringUtils::format("        <key>size</key>\n        <string>{%d,%d}</string>\n", atlasWidth, atlasHeight);
+        plist += StringUtils::format("        <key>textureFileName</key>\n        <string>%s</string>\n", textureName.c_str());
+        plist += "    </dict>\n</dict>\n</plist>\n";
+        return plist;
+    }
+}
+
+int main(int argc, char** argv) {
+    int padding = 2;
+    std::vector<std::string> positional;
+
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--padding") == 0 && i + 1 < argc) padding = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--help") == 0 || strcmp(argv[i], "-h") == 0) {
+            printUsage();
+            return 0;
+        }
+        else positional.push_back(argv[i]);
+    }
+
+    if (positional.size() != 2) {
+        printUsage();
+        return 2;
+    }
+    // 外扩边占 1 像素，间距至少为 2 才能保证相邻帧的外扩边不互相覆盖
+    padding = std::max(padding, 2);
+
+    std::string inputDir = toAbsolutePath(positional[0]);
+    std::string outputPrefix = toAbsolutePath(positional[1]);
+    if (inputDir.back() != '/') inputDir += "/";
+
+    // 1. 读取目录下的所有 PNG (按文件名排序，保证输出稳定)
+    // 图集按原始像素打包，关闭 PNG 预乘，由运行时加载纹理时统一处理
+    Image::setPNGPremultipliedAlphaEnabled(false);
+
+    std::vector<std::string> files = FileUtils::getInstance()->listFiles(inputDir);
+    std::sort(files.begin(), files.end());
+
+    std::vector<FrameImage> frames;
+    long long totalArea = 0;
+    for (const auto& file : files) {
+        if (FileUtils::getInstance()->getFileExtension(file) != ".png") continue;
+
+        FrameImage frame;
+        if (!loadFrame(file, frame)) {
+            fprintf(stderr, "skip unreadable image: %s\n", file.c_str());
+            continue;
+        }
+        totalArea += (long long)(frame.width + padding) * (frame.height + padding);
+        frames.push_back(std::move(frame));
+    }
+
+    if (frames.empty()) {
+        fprintf(stderr, "no png found in %s\n", inputDir.c_str());
+        return 1;
+    }
+
+    // 2. 高的帧优先，同高按名称，减少每行的空隙
+    std::stable_sort(frames.begin(), frames.end(), [](const FrameImage& a, const FrameImage& b) {
+        return a.height > b.height;
+    });
+
+    // 3. 从能容纳总面积的最小 2 的幂宽度开始尝试，高度同样取 2 的幂
+    int atlasWidth = nextPowerOfTwo((int)std::ceil(std::sqrt((double)totalArea)));
+    int atlasHeight = -1;
+    for (; atlasWidth <= kMaxAtlasSize; atlasWidth <<= 1) {
+        int used = layoutFrames(frames, atlasWidth, padding);
+        if (used > 0 && used <= kMaxAtlasSize) {
+            atlasHeight = nextPowerOfTwo(used);
+            break;
+        }
+    }
+
+    if (atlasHeight < 0) {
+        fprintf(stderr, "frames do not fit in a %dx%d atlas\n", kMaxAtlasSize, kMaxAtlasSize);
+        return 1;
+    }
+
+    // 4. 合成并输出
+    std::vector<unsigned char> atlas((size_t)atlasWidth * atlasHeight * 4, 0);
+    for (const auto& frame : frames) {
+        blitFrame(atlas, atlasWidth, atlasHeight, frame);
+    }
+
+    std::string pngPath = outputPrefix + ".png";
+    std::string plistPath = outputPrefix + ".plist";
+
+    Image* output = new (std::nothrow) Image();
+    bool saved = output && output->initWithRawData(atlas.data(), (ssize_t)atlas.size(), atlasWidth, atlasHeight, 8)
+        && output->saveToFile(pngPath, false);
+    CC_SAFE_RELEASE(output);
+    if (!saved) {
+        fprintf(stderr, "failed to write %s\n", pngPath.c_str());
+        return 1;
+    }
+
+    std::sort(frames.begin(), frames.end(), [](const FrameImage& a, const FrameImage& b) {
+        return a.name < b.name;
+    });
+    if (!FileUtils::getInstance()->writeStringToFile(buildPlist(frames, baseName(pngPath), atlasWidth, atlasHeight), plistPath)) {
+        fprintf(stderr, "failed to write %s\n", plistPath.c_str());
+        return 1;
+    }
+
+    printf("%s: %d frames, %dx%d\n", plistPath.c_str(), (int)frames.size(), atlasWidth, atlasHeight);
+    return 0;
+}
@@ -0,0 +1,217 @@
+/**
+ * @file main.cpp
+ * @brief level_difficulty 命令行工具
+ * 对每个关卡并行运行 N 局 epsilon-greedy 随机对局，输出胜率、平均剩余牌数及 95% 置信区间。
+ *
+ * 用法: level_difficulty [--playouts N] [--epsilon E] [--threads T] [--seed S] [--json] level_*.json
+ */
+#include "cocos2d.h"
+#include "configs/LevelConfigLoader.h"
+#include "services/GameModelGenerator.h"
+#include "services/GameRuleService.h"
+#include "services/PlayoutSimulator.h"
+#include "json/stringbuffer.h"
+#include "json/prettywriter.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef _WIN32
+#include <direct.h>
+#define getcwd _getcwd
+#else
+#include <unistd.h>
+#endif
+
+USING_NS_CC;
+
+namespace {
+    const int kChunkSize = 256;    ///< 每个任务块的对局数，块越小负载越均衡
+
+    /**
+     * @brief 单个关卡的初始局面 (主线程构建，工作线程只读)
+     */
+    struct LevelEntry {
+        std::string file;
+        bool valid = false;
+        CompactGameState start;
+        BlockerMasks blockers;
+        PlayoutStats stats;
+    };
+
+    /**
+     * @brief 任务块：某关卡的一段对局
+     */
+    struct WorkItem {
+        int levelIndex;
+        int chunkIndex;
+        int playouts;
+        PlayoutStats result;
+    };
+
+    std::string toAbsolutePath(const std::string& path) {
+        if (FileUtils::getInstance()->isAbsolutePath(path)) return path;
+
+        char cwd[4096];
+        if (!getcwd(cwd, sizeof(cwd))) return path;
+        return std::string(cwd) + "/" + path;
+    }
+
+    // 由 (种子, 关卡, 块) 推导块种子，保证结果与线程数和调度顺序无关
+    uint64_t chunkSeed(uint64_t seed, int levelIndex, int chunkIndex) {
+        uint64_t z = seed ^ ((uint64_t)levelIndex << 32) ^ (uint64_t)chunkIndex;
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+
+    void printUsage() {
+        printf("Usage: level_difficulty [options] <level.json>...\n");
+        printf("  --playouts N  playouts per level (default 1000)\n");
+        printf("  --epsilon E   exploration probability (default 0.1)\n");
+        printf("  --threads T   worker threads (default: hardware concurrency)\n");
+        printf("  --seed S      random seed (default 1)\n");
+        printf("  --json        emit JSON instead of CSV\n");
+    }
+
+    void printCsv(const std::vector<LevelEntry>& levels) {
+        printf("level,playouts,win_rate,win_rate_low,win_rate_high,avg_remaining,remaining_margin\n");
+        for (const auto& level : levels) {
+            if (!level.valid) {
+                printf("%s,0,,,,,\n", level.file.c_str());
+                continue;
+            }
+            double low, high;
+            level.stats.getWinRateInterval(low, high);
+            printf("%s,%lld,%.4f,%.4f,%.4f,%.3f,%.3f\n", level.file.c_str(), level.stats.playouts,
+                level.stats.getWinRate(), low, high,
+                level.stats.getAverageRemaining(), level.stats.getRemainingMargin());
+        }
+    }
+
+    void printJson(const std::vector<LevelEntry>& levels) {
+        rapidjson::StringBuffer buffer;
+        rapidjson::PrettyWriter<rapidjson::StringBuffer> writer(buffer);
+
+        writer.StartArray();
+        for (const auto& level : levels) {
+            writer.StartObject();
+            writer.Key("level");
+            writer.String(level.file.c_str());
+            writer.Key("valid");
+            writer.Bool(level.valid);
+            if (level.valid) {
+                double low, high;
+                level.stats.getWinRateInterval(low, high);
+                writer.Key("playouts");
+                writer.Int64(level.stats.playouts);
+                writer.Key("winRate");
+                writer.Double(level.stats.getWinRate());
+                writer.Key("winRateLow");
+                writer.Double(low);
+                writer.Key("winRateHigh");
+                writer.Double(high);
+                writer.Key("avgRemaining");
+                writer.Double(level.stats.getAverageRemaining());
+                writer.Key("remainingMargin");
+                writer.Double(level.stats.getRemainingMargin());
+            }
+            writer.EndObject();
+        }
+        writer.EndArray();
+        printf("%s\n", buffer.GetString());
+    }
+}
+
+int main(int argc, char** argv) {
+    int playouts = 1000;
+    double epsilon = 0.1;
+    int threadCount = (int)std::thread::hardware_concurrency();
+    uint64_t seed = 1;
+    bool json = false;
+    std::vector<LevelEntry> levels;
+
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--playouts") == 0 && i + 1 < argc) playouts = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--epsilon") == 0 && i + 1 < argc) epsilon = atof(argv[++i]);
+        else if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc) threadCount = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) seed = strtoull(argv[++i], nullptr, 10);
+        else if (strcmp(argv[i], "--json") == 0) json = true;
+        else if (strcmp(argv[i], "--help") == 0 || strcmp(argv[i], "-h") == 0) {
+            printUsage();
+            return 0;
+        }
+        else {
+            LevelEntry entry;
+            entry.file = toAbsolutePath(argv[i]);
+            levels.push_back(entry);
+        }
+    }
+
+    if (levels.empty() || playouts <= 0) {
+        printUsage();
+        return 2;
+    }
+    if (threadCount <= 0) threadCount = 1;
+
+    auto batchStart = std::chrono::steady_clock::now();
+
+    // 1. 主线程：加载关卡并构建初始局面 (GameModel 基于 Ref，不在工作线程中创建)
+    for (auto& level : levels) {
+        AutoreleasePool pool;
+
+        LevelConfig config = LevelConfigLoader::loadLevel(level.file);
+        if (!config.isValid()) continue;
+
+        auto model = GameModel::create();
+        GameModelGenerator::generate(model, config);
+        GameRuleService::updateFaceUpStates(model);
+
+        if (!CompactGameState::fromModel(model, level.start)) continue;
+        level.blockers = GameRuleService::buildBlockerMasks(model);
+        level.valid = true;
+    }
+
+    // 2. 切分任务块
+    std::vector<WorkItem> items;
+    for (int l = 0; l < (int)levels.size(); ++l) {
+        if (!levels[l].valid) continue;
+        for (int done = 0, chunk = 0; done < playouts; done += kChunkSize, ++chunk) {
+            items.push_back({ l, chunk, std::min(kChunkSize, playouts - done), PlayoutStats() });
+        }
+    }
+
+    // 3. 工作线程按原子计数领取任务块，每块写入各自的结果槽，无需加锁
+    std::atomic<size_t> nextItem(0);
+    auto worker = [&]() {
+        for (size_t i = nextItem++; i < items.size(); i = nextItem++) {
+            WorkItem& item = items[i];
+            const LevelEntry& level = levels[item.levelIndex];
+            item.result = PlayoutSimulator::run(level.start, level.blockers, item.playouts, epsilon,
+                chunkSeed(seed, item.levelIndex, item.chunkIndex));
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; ++t) threads.emplace_back(worker);
+    for (auto& thread : threads) thread.join();
+
+    // 4. 按任务顺序归并，输出稳定
+    for (const auto& item : items) {
+        levels[item.levelIndex].stats.merge(item.result);
+    }
+
+    if (json) printJson(levels);
+    else printCsv(levels);
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - batchStart).count();
+    fprintf(stderr, "%d levels x %d playouts on %d threads, %.3fs\n",
+        (int)levels.size(), playouts, threadCount, seconds);
+    return 0;
+}
@@ -0,0 +1,126 @@
+/**
+ * @file main.cpp
+ * @brief level_generator 命令行工具
+ * 批量生成必定可解的 TriPeaks 关卡，按 LevelConfigLoader 的 JSON 格式写入输出目录，
+ * 并在标准输出打印每关的统计 (CSV)。
+ *
+ * 用法: level_generator [--count N] [--difficulty D] [--peaks P] [--rows R] [--seed S]
+ *                       [--first-id K] [--out DIR] [--verify]
+ */
+#include "cocos2d.h"
+#include "configs/LevelConfigWriter.h"
+#include "services/LevelGenerator.h"
+#include "services/LevelSolver.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#ifdef _WIN32
+#include <direct.h>
+#define getcwd _getcwd
+#else
+#include <unistd.h>
+#endif
+
+USING_NS_CC;
+
+namespace {
+    // FileUtils 默认以可执行文件旁的 Resources 目录为根，命令行参数按当前目录解析
+    std::string toAbsolutePath(const std::string& path) {
+        if (FileUtils::getInstance()->isAbsolutePath(path)) return path;
+
+        char cwd[4096];
+        if (!getcwd(cwd, sizeof(cwd))) return path;
+        return std::string(cwd) + "/" + path;
+    }
+
+    void printUsage() {
+        printf("Usage: level_generator [options]\n");
+        printf("  --count N       number of levels (default 1)\n");
+        printf("  --difficulty D  target difficulty in [0, 1] (default 0.5)\n");
+        printf("  --peaks P       number of peaks (default 3)\n");
+        printf("  --rows R        rows per peak including the shared bottom row (default 4)\n");
+        printf("  --seed S        random seed (default 1)\n");
+        printf("  --first-id K    levelId of the first level (default 1)\n");
+        printf("  --out DIR       write level_<id>.json into DIR (default: statistics only)\n");
+        printf("  --verify        re-check every level with LevelSolver\n");
+    }
+}
+
+int main(int argc, char** argv) {
+    GeneratorOptions options;
+    int count = 1;
+    int firstId = 1;
+    uint64_t seed = 1;
+    bool verify = false;
+    std::string outDir;
+
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--count") == 0 && i + 1 < argc) count = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--difficulty") == 0 && i + 1 < argc) options.difficulty = (float)atof(argv[++i]);
+        else if (strcmp(argv[i], "--peaks") == 0 && i + 1 < argc) options.peakCount = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--rows") == 0 && i + 1 < argc) options.peakRows = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) seed = strtoull(argv[++i], nullptr, 10);
+        else if (strcmp(argv[i], "--first-id") == 0 && i + 1 < argc) firstId = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--out") == 0 && i + 1 < argc) outDir = toAbsolutePath(argv[++i]);
+        else if (strcmp(argv[i], "--verify") == 0) verify = true;
+        else {
+            printUsage();
+            return strcmp(argv[i], "--help") == 0 || strcmp(argv[i], "-h") == 0 ? 0 : 2;
+        }
+    }
+
+    // 布局与参数一一对应，整批只构建一次
+    LevelLayout layout = LevelGenerator::buildLayout(options.peakCount, options.peakRows);
+    if (count <= 0 || !layout.isValid()) {
+        printUsage();
+        return 2;
+    }
+    if (!outDir.empty() && !FileUtils::getInstance()->createDirectory(outDir)) {
+        fprintf(stderr, "Cannot create output directory: %s\n", outDir.c_str());
+        return 1;
+    }
+
+    SolveOptions solveOptions;
+    solveOptions.findMinimumDraws = false;
+
+    std::mt19937_64 rng(seed);
+    int failed = 0;
+    auto batchStart = std::chrono::steady_clock::now();
+
+    printf("level,playfield,draw_stack,plan_draws,spare,verified\n");
+    for (int i = 0; i < count; ++i) {
+        options.levelId = firstId + i;
+        GeneratedLevel level = LevelGenerator::generate(layout, options, rng);
+        if (!level.success) {
+            printf("%d,0,0,,,fail\n", options.levelId);
+            failed++;
+            continue;
+        }
+
+        const char* verified = "-";
+        if (verify) {
+            AutoreleasePool pool;
+            SolveResult result = LevelSolver::solve(level.config, solveOptions);
+            verified = result.solvable ? "yes"
+                : (result.unsupported ? "unsupported" : (result.aborted ? "aborted" : "no"));
+            if (!result.solvable) failed++;
+        }
+
+        if (!outDir.empty()) {
+            std::string file = StringUtils::format("%s/level_%d.json", outDir.c_str(), options.levelId);
+            if (!LevelConfigWriter::saveLevel(level.config, file)) failed++;
+        }
+
+        printf("%d,%d,%d,%d,%d,%s\n", options.levelId,
+            (int)level.config.playfieldCards.size(), (int)level.config.drawStackCards.size(),
+            level.planDraws, level.spareCards, verified);
+    }
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - batchStart).count();
+    fprintf(stderr, "%d levels, %d failed, %.3fs (%.0f levels/min)\n",
+        count, failed, seconds, seconds > 0 ? count * 60.0 / seconds : 0.0);
+    return failed > 0 ? 1 : 0;
+}
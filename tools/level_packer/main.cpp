@@ -0,0 +1,126 @@
+/**
+ * @file main.cpp
+ * @brief level_packer 命令行工具
+ * 将若干 level_<id>.json 编译为单个二进制关卡包 (格式见 LevelPack.h)，供发布版本内存映射读取。
+ * JSON 仍是关卡的编辑格式，修改关卡后需重新打包。
+ *
+ * 用法: level_packer [--out FILE] [--verify] level_1.json level_2.json ...
+ */
+#include "cocos2d.h"
+#include "configs/LevelConfigLoader.h"
+#include "configs/LevelPack.h"
+#include "configs/LevelPackWriter.h"
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#include <direct.h>
+#define getcwd _getcwd
+#else
+#include <unistd.h>
+#endif
+
+USING_NS_CC;
+
+namespace {
+    // FileUtils 默认以可执行文件旁的 Resources 目录为根，命令行参数按当前目录解析
+    std::string toAbsolutePath(const std::string& path) {
+        if (FileUtils::getInstance()->isAbsolutePath(path)) return path;
+
+        char cwd[4096];
+        if (!getcwd(cwd, sizeof(cwd))) return path;
+        return std::string(cwd) + "/" + path;
+    }
+
+    void printUsage() {
+        printf("Usage: level_packer [--out FILE] [--verify] <level.json>...\n");
+        printf("  --out FILE  output pack (default: levels.pack)\n");
+        printf("  --verify    reopen the pack and compare every level with its JSON source\n");
+    }
+
+    bool sameCard(const CardConfigData& a, const CardConfigData& b) {
+        return a.cardFace == b.cardFace && a.cardSuit == b.cardSuit && a.x == b.x && a.y == b.y
+            && a.zOrder == b.zOrder && a.isFaceUp == b.isFaceUp && a.deck == b.deck;
+    }
+
+    bool samePile(const CardConfigData* packed, int count, const std::vector<CardConfigData>& source) {
+        if (count != (int)source.size()) return false;
+        for (int i = 0; i < count; ++i) {
+            if (!sameCard(packed[i], source[i])) return false;
+        }
+        return true;
+    }
+}
+
+int main(int argc, char** argv) {
+    std::string output = "levels.pack";
+    bool verify = false;
+    std::vector<std::string> files;
+
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--out") == 0 && i + 1 < argc) {
+            output = argv[++i];
+        }
+        else if (strcmp(argv[i], "--verify") == 0) {
+            verify = true;
+        }
+        else if (strcmp(argv[i], "--help") == 0 || strcmp(argv[i], "-h") == 0) {
+            printUsage();
+            return 0;
+        }
+        else {
+            files.push_back(toAbsolutePath(argv[i]));
+        }
+    }
+
+    if (files.empty()) {
+        printUsage();
+        return 2;
+    }
+    output = toAbsolutePath(output);
+
+    // 1. 读取全部 JSON
+    auto start = std::chrono::steady_clock::now();
+    std::vector<LevelConfig> levels;
+    levels.reserve(files.size());
+    for (const auto& file : files) {
+        LevelConfig config = LevelConfigLoader::loadLevel(file);
+        if (!config.isValid()) {
+            fprintf(stderr, "invalid level: %s\n", file.c_str());
+            return 1;
+        }
+        levels.push_back(std::move(config));
+    }
+
+    // 2. 编译并写出
+    if (!LevelPackWriter::savePack(levels, output)) {
+        fprintf(stderr, "failed to write %s\n", output.c_str());
+        return 1;
+    }
+
+    // 3. 可选：重新打开并逐关比对
+    int mismatches = 0;
+    if (verify) {
+        LevelPack pack;
+        if (!pack.open(output) || pack.getLevelCount() != (int)levels.size()) {
+            fprintf(stderr, "failed to reopen %s\n", output.c_str());
+            return 1;
+        }
+        for (const auto& level : levels) {
+            LevelPack::LevelView view = pack.getLevel(level.levelId);
+            if (!samePile(view.playfield, view.playfieldCount, level.playfieldCards)
+                || !samePile(view.drawStack, view.drawStackCount, level.drawStackCards)) {
+                fprintf(stderr, "level %d differs after packing\n", level.levelId);
+                mismatches++;
+            }
+        }
+    }
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    fprintf(stderr, "%d levels -> %s, %.3fs%s\n", (int)levels.size(), output.c_str(), seconds,
+        verify ? (mismatches == 0 ? ", verified" : ", VERIFY FAILED") : "");
+    return mismatches > 0 ? 1 : 0;
+}
@@ -0,0 +1,197 @@
+/**
+ * @file main.cpp
+ * @brief level_parse_bench 命令行工具
+ * 对比关卡 JSON 的两种解析方式：旧的 rapidjson DOM + HasMember/GetInt 拷贝，
+ * 与 LevelConfigLoader::parseLevel 的 SAX 原地解析。默认在内存中生成 1000 / 5000 张牌的排版 JSON，
+ * 也可以传入关卡文件。两种方式的结果不一致时返回非 0。
+ *
+ * 用法: level_parse_bench [--iterations N] [--cards N]... [level.json]...
+ */
+#include "cocos2d.h"
+#include "configs/LevelConfigLoader.h"
+#include "configs/LevelConfigWriter.h"
+#include "json/document.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#include <direct.h>
+#define getcwd _getcwd
+#else
+#include <unistd.h>
+#endif
+
+USING_NS_CC;
+
+namespace {
+    struct Sample {
+        std::string name;
+        std::string json;
+    };
+
+    // FileUtils 默认以可执行文件旁的 Resources 目录为根，命令行参数按当前目录解析
+    std::string toAbsolutePath(const std::string& path) {
+        if (FileUtils::getInstance()->isAbsolutePath(path)) return path;
+
+        char cwd[4096];
+        if (!getcwd(cwd, sizeof(cwd))) return path;
+        return std::string(cwd) + "/" + path;
+    }
+
+    void printUsage() {
+        printf("Usage: level_parse_bench [--iterations N] [--cards N]... [level.json]...\n");
+        printf("  --iterations N  timed parses per sample and method (default 200)\n");
+        printf("  --cards N       add a generated level with N playfield cards (default: 1000 and 5000)\n");
+    }
+
+    // 生成带小数坐标的排版 JSON (与手写关卡文件格式一致)
+    std::string makeLevelJson(int cards, unsigned seed) {
+        std::mt19937 rng(seed);
+        LevelConfig config;
+        config.levelId = cards;
+        for (int i = 0; i < cards + cards / 4; ++i) {
+            CardConfigData card;
+            card.cardFace = (int)(rng() % 13) + 1;
+            card.cardSuit = (int)(rng() % 4);
+            card.x = (float)(rng() % 10800) / 10.0f;
+            card.y = (float)(rng() % 20000) / 10.0f;
+            card.zOrder = i;
+            card.isFaceUp = (rng() & 1) != 0;
+            card.deck = 0;
+            if (i < cards) config.playfieldCards.push_back(card);
+            else config.drawStackCards.push_back(card);
+        }
+        return LevelConfigWriter::toJson(config, true);
+    }
+
+    // 旧实现：构建完整 DOM 后逐字段查找
+    CardConfigData parseCardDom(const rapidjson::Value& item) {
+        CardConfigData card;
+        card.cardFace = item.HasMember("face") ? item["face"].GetInt() : 1;
+        card.cardSuit = item.HasMember("suit") ? item["suit"].GetInt() : 1;
+        card.x = item.HasMember("x") ? item["x"].GetFloat() : 0.0f;
+        card.y = item.HasMember("y") ? item["y"].GetFloat() : 0.0f;
+        card.zOrder = item.HasMember("z") ? item["z"].GetInt() : 0;
+        card.isFaceUp = item.HasMember("faceUp") ? item["faceUp"].GetBool() : false;
+        card.deck = item.HasMember("deck") ? (uint8_t)item["deck"].GetInt() : 0;
+        return card;
+    }
+
+    bool parseLevelDom(const std::string& json, LevelConfig& config) {
+        rapidjson::Document doc;
+        doc.Parse(json.c_str());
+        if (doc.HasParseError()) return false;
+
+        if (doc.HasMember("levelId")) config.levelId = doc["levelId"].GetInt();
+        if (doc.HasMember("playfield") && doc["playfield"].IsArray()) {
+            const rapidjson::Value& arr = doc["playfield"];
+            for (rapidjson::SizeType i = 0; i < arr.Size(); ++i) config.playfieldCards.push_back(parseCardDom(arr[i]));
+        }
+        if (doc.HasMember("drawStack") && doc["drawStack"].IsArray()) {
+            const rapidjson::Value& arr = doc["drawStack"];
+            for (rapidjson::SizeType i = 0; i < arr.Size(); ++i) config.drawStackCards.push_back(parseCardDom(arr[i]));
+        }
+        return true;
+    }
+
+    // 与 loadLevel 相同：在读入的字符串上原地解析 (拷贝计入耗时，对应从文件读出的那份缓冲)
+    bool parseLevelSax(const std::string& json, LevelConfig& config) {
+        std::string buffer = json;
+        return LevelConfigLoader::parseLevel(&buffer[0], buffer.size(), config);
+    }
+
+    bool samePile(const std::vector<CardConfigData>& a, const std::vector<CardConfigData>& b) {
+        if (a.size() != b.size()) return false;
+        for (size_t i = 0; i < a.size(); ++i) {
+            if (a[i].cardFace != b[i].cardFace || a[i].cardSuit != b[i].cardSuit || a[i].x != b[i].x
+                || a[i].y != b[i].y || a[i].zOrder != b[i].zOrder || a[i].isFaceUp != b[i].isFaceUp
+                || a[i].deck != b[i].deck) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // 返回单次解析耗时的中位数 (微秒)
+    template <typename Parser>
+    double measure(const std::string& json, int iterations, Parser parser) {
+        std::vector<double> samples;
+        samples.reserve(iterations);
+        for (int i = 0; i < iterations + iterations / 10; ++i) {
+            LevelConfig config;
+            auto start = std::chrono::steady_clock::now();
+            parser(json, config);
+            double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+            if (i >= iterations / 10) samples.push_back(us);    // 前 10% 作为预热
+        }
+        std::sort(samples.begin(), samples.end());
+        return samples[samples.size() / 2];
+    }
+}
+
+int main(int argc, char** argv) {
+    int iterations = 200;
+    std::vector<int> cardCounts;
+    std::vector<std::string> files;
+
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--iterations") == 0 && i + 1 < argc) {
+            iterations = std::max(1, atoi(argv[++i]));
+        }
+        else if (strcmp(argv[i], "--cards") == 0 && i + 1 < argc) {
+            cardCounts.push_back(std::max(1, atoi(argv[++i])));
+        }
+        else if (strcmp(argv[i], "--help") == 0 || strcmp(argv[i], "-h") == 0) {
+            printUsage();
+            return 0;
+        }
+        else {
+            files.push_back(toAbsolutePath(argv[i]));
+        }
+    }
+    if (cardCounts.empty() && files.empty()) cardCounts = { 1000, 5000 };
+
+    std::vector<Sample> samples;
+    for (int cards : cardCounts) {
+        samples.push_back({ StringUtils::format("generated_%d", cards), makeLevelJson(cards, (unsigned)cards) });
+    }
+    for (const auto& file : files) {
+        std::string json = FileUtils::getInstance()->getStringFromFile(file);
+        if (json.empty()) {
+            fprintf(stderr, "unreadable: %s\n", file.c_str());
+            return 1;
+        }
+        samples.push_back({ file, json });
+    }
+
+    int mismatches = 0;
+    printf("sample,bytes,cards,dom_us,sax_us,speedup\n");
+    for (const auto& sample : samples) {
+        // 1. 结果一致性
+        LevelConfig dom, sax;
+        dom.levelId = sax.levelId = 0;
+        if (!parseLevelDom(sample.json, dom) || !parseLevelSax(sample.json, sax)) {
+            fprintf(stderr, "parse error: %s\n", sample.name.c_str());
+            return 1;
+        }
+        if (dom.levelId != sax.levelId || !samePile(dom.playfieldCards, sax.playfieldCards)
+            || !samePile(dom.drawStackCards, sax.drawStackCards)) {
+            fprintf(stderr, "results differ: %s\n", sample.name.c_str());
+            mismatches++;
+        }
+
+        // 2. 计时
+        double domUs = measure(sample.json, iterations, parseLevelDom);
+        double saxUs = measure(sample.json, iterations, parseLevelSax);
+        printf("%s,%d,%d,%.1f,%.1f,%.2f\n", sample.name.c_str(), (int)sample.json.size(),
+            (int)(dom.playfieldCards.size() + dom.drawStackCards.size()), domUs, saxUs,
+            saxUs > 0 ? domUs / saxUs : 0.0);
+    }
+    return mismatches > 0 ? 1 : 0;
+}
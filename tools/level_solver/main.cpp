@@ -0,0 +1,99 @@
+/**
+ * @file main.cpp
+ * @brief level_solver 命令行工具
+ * 批量加载关卡 JSON，输出可解性、最少抽牌数与搜索统计。存在无解关卡时返回非 0，便于 CI 校验。
+ *
+ * 用法: level_solver [--first] [--max-nodes N] level_1.json level_2.json ...
+ */
+#include "cocos2d.h"
+#include "configs/LevelConfigLoader.h"
+#include "services/LevelSolver.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#include <direct.h>
+#define getcwd _getcwd
+#else
+#include <unistd.h>
+#endif
+
+USING_NS_CC;
+
+namespace {
+    // FileUtils 默认以可执行文件旁的 Resources 目录为根，命令行参数按当前目录解析
+    std::string toAbsolutePath(const std::string& path) {
+        if (FileUtils::getInstance()->isAbsolutePath(path)) return path;
+
+        char cwd[4096];
+        if (!getcwd(cwd, sizeof(cwd))) return path;
+        return std::string(cwd) + "/" + path;
+    }
+
+    void printUsage() {
+        printf("Usage: level_solver [--first] [--max-nodes N] <level.json>...\n");
+        printf("  --first        stop at the first solution instead of minimizing draws\n");
+        printf("  --max-nodes N  abort a level after N search nodes (default 2000000)\n");
+    }
+}
+
+int main(int argc, char** argv) {
+    SolveOptions options;
+    std::vector<std::string> files;
+
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--first") == 0) {
+            options.findMinimumDraws = false;
+        }
+        else if (strcmp(argv[i], "--max-nodes") == 0 && i + 1 < argc) {
+            options.maxNodes = atoll(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--help") == 0 || strcmp(argv[i], "-h") == 0) {
+            printUsage();
+            return 0;
+        }
+        else {
+            files.push_back(toAbsolutePath(argv[i]));
+        }
+    }
+
+    if (files.empty()) {
+        printUsage();
+        return 2;
+    }
+
+    int unsolvable = 0;
+    int aborted = 0;
+    auto batchStart = std::chrono::steady_clock::now();
+
+    printf("level,solvable,min_draws,nodes,tt_hits,dead_ends,ms\n");
+    for (const auto& file : files) {
+        // 每关使用独立的自动释放池，避免无主循环时 Model 对象堆积
+        AutoreleasePool pool;
+
+        auto start = std::chrono::steady_clock::now();
+        LevelConfig config = LevelConfigLoader::loadLevel(file);
+        SolveResult result = LevelSolver::solve(config, options);
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        const char* verdict = result.unsupported ? "unsupported"
+            : (result.aborted ? "aborted" : (result.solvable ? "yes" : "no"));
+        printf("%s,%s,%d,%lld,%lld,%lld,%.3f\n",
+            file.c_str(), verdict, result.minDraws,
+            result.nodes, result.transpositionHits, result.deadEnds, ms);
+
+        if (result.aborted) aborted++;
+        else if (!result.solvable) unsolvable++;
+    }
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - batchStart).count();
+    fprintf(stderr, "%d levels, %d unsolvable, %d aborted, %.3fs (%.0f levels/min)\n",
+        (int)files.size(), unsolvable, aborted, seconds,
+        seconds > 0 ? files.size() * 60.0 / seconds : 0.0);
+
+    return (unsolvable > 0 || aborted > 0) ? 1 : 0;
+}
@@ -0,0 +1,227 @@
+/**
+ * @file main.cpp
+ * @brief render_batch_bench 命令行工具
+ * 测量 Renderer 合批时填充顶点 / 索引的吞吐量，需要以 -DCC_ENABLE_NULL_RENDERER=ON 构建引擎。
+ * 1. 核心循环：同一组精灵四边形分别用旧实现 (memcpy 后逐顶点 Mat4::transformPoint、逐个重定位索引)
+ *    与 MathUtil::transformVertices / transformIndices 填入批次缓冲，对比每秒顶点数，结果不一致时返回非 0。
+ * 2. 整帧：在 null 渲染后端上用 GLViewHeadless 驱动 Director，绘制 N 个静止或每帧旋转的精灵，
+ *    输出帧耗时、每秒顶点数与沿用上一帧结果而未重新变换的顶点数，可在改动前后的构建间对比。
+ *
+ * 用法: render_batch_bench [--iterations N] [--frames N] [--sprites N]...
+ */
+#include "cocos2d.h"
+#include "platform/headless/CCGLViewHeadless.h"
+#include "renderer/backend/null/DeviceNull.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+USING_NS_CC;
+
+namespace {
+    // Director 调整帧间隔时需要 Application 实例
+    class BenchApplication : public Application {
+    public:
+        virtual bool applicationDidFinishLaunching() override { return true; }
+        virtual void applicationDidEnterBackground() override {}
+        virtual void applicationWillEnterForeground() override {}
+    };
+
+    /**
+     * @brief 一个精灵的三角形命令：四个本地坐标顶点、两个三角形与模型视图矩阵
+     */
+    struct QuadCommand {
+        V3F_C4B_T2F vertices[4];
+        unsigned short indices[6];
+        Mat4 modelView;
+    };
+
+    void printUsage() {
+        printf("Usage: render_batch_bench [--iterations N] [--frames N] [--sprites N]...\n");
+        printf("  --iterations N  timed batch fills per sprite count (default 200)\n");
+        printf("  --frames N      measured frames per scene on the null backend (default 300)\n");
+        printf("  --sprites N     add a sprite count (default: 100, 1000 and 10000)\n");
+    }
+
+    std::vector<QuadCommand> makeQuads(int count, unsigned seed) {
+        std::mt19937 rng(seed);
+        std::vector<QuadCommand> quads(count);
+        for (auto& quad : quads) {
+            float w = 60.0f + (float)(rng() % 40);
+            float h = w * 1.4f;
+            Vec2 corners[4] = { Vec2(0, h), Vec2(0, 0), Vec2(w, h), Vec2(w, 0) };
+            for (int i = 0; i < 4; ++i) {
+                quad.vertices[i].vertices.set(corners[i].x, corners[i].y, 0.0f);
+                quad.vertices[i].colors = Color4B((uint8_t)rng(), (uint8_t)rng(), (uint8_t)rng(), 255);
+                quad.vertices[i].texCoords = Tex2F((float)(i / 2), (float)(i % 2));
+            }
+            const unsigned short indices[6] = { 0, 1, 2, 3, 2, 1 };
+            memcpy(quad.indices, indices, sizeof(indices));
+
+            Mat4::createTranslation((float)(rng() % 540), (float)(rng() % 1040), 0.0f, &quad.modelView);
+            quad.modelView.rotateZ((float)(rng() % 628) / 100.0f);
+            quad.modelView.scale(0.5f + (float)(rng() % 100) / 100.0f);
+        }
+        return quads;
+    }
+
+    // 旧实现 (Renderer::fillVerticesAndIndices 改用 MathUtil 之前)
+    void fillLegacy(const std::vector<QuadCommand>& quads, V3F_C4B_T2F* verts, unsigned short* indices) {
+        size_t filledVertex = 0;
+        size_t filledIndex = 0;
+        for (const auto& quad : quads) {
+            memcpy(&verts[filledVertex], quad.vertices, sizeof(quad.vertices));
+            for (size_t i = 0; i < 4; ++i) {
+                quad.modelView.transformPoint(&(verts[i + filledVertex].vertices));
+            }
+            for (size_t i = 0; i < 6; ++i) {
+                indices[filledIndex + i] = (unsigned short)(filledVertex + quad.indices[i]);
+            }
+            filledVertex += 4;
+            filledIndex += 6;
+        }
+    }
+
+    void fillSimd(const std::vector<QuadCommand>& quads, V3F_C4B_T2F* verts, unsigned short* indices) {
+        size_t filledVertex = 0;
+        size_t filledIndex = 0;
+        for (const auto& quad : quads) {
+            MathUtil::transformVertices(&verts[filledVertex], quad.vertices, 4, quad.modelView);
+            MathUtil::transformIndices(&indices[filledIndex], quad.indices, 6, (unsigned short)filledVertex);
+            filledVertex += 4;
+            filledIndex += 6;
+        }
+    }
+
+    // 返回单次填充耗时的中位数 (微秒)
+    template <typename Filler>
+    double measure(const std::vector<QuadCommand>& quads, int iterations, V3F_C4B_T2F* verts, unsigned short* indices,
+        Filler filler) {
+        std::vector<double> samples;
+        samples.reserve(iterations);
+        for (int i = 0; i < iterations + iterations / 10; ++i) {
+            auto start = std::chrono::steady_clock::now();
+            filler(quads, verts, indices);
+            double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+            if (i >= iterations / 10) samples.push_back(us);    // 前 10% 作为预热
+        }
+        std::sort(samples.begin(), samples.end());
+        return samples[samples.size() / 2];
+    }
+
+    // 批次缓冲中的索引为 unsigned short，每批最多 65536 个顶点
+    std::vector<QuadCommand> clampToBatch(std::vector<QuadCommand> quads) {
+        if (quads.size() > 65536 / 4) quads.resize(65536 / 4);
+        return quads;
+    }
+
+    /**
+     * @brief 在 null 后端上绘制 sprites 个精灵
+     * @param rotating 为 true 时每帧旋转全部精灵，否则场景完全静止
+     * @param reusedVertices 输出最后一帧沿用上一帧结果的顶点数
+     * @return double 帧耗时中位数 (毫秒)
+     */
+    double measureFrames(GLViewHeadless* view, int sprites, bool rotating, int frames, int& reusedVertices) {
+        auto director = Director::getInstance();
+        auto scene = Scene::create();
+        std::mt19937 rng((unsigned)sprites);
+        for (int i = 0; i < sprites; ++i) {
+            auto sprite = Sprite::create();
+            sprite->setTextureRect(Rect(0, 0, 60, 84));
+            sprite->setPosition(30.0f + (float)(rng() % 480), 42.0f + (float)(rng() % 956));
+            sprite->setRotation((float)(rng() % 360));
+            if (rotating) sprite->runAction(RepeatForever::create(RotateBy::create(1.0f, 90.0f)));
+            scene->addChild(sprite);
+        }
+        if (director->getRunningScene()) director->replaceScene(scene);
+        else director->runWithScene(scene);
+
+        view->runFrames(10);
+        size_t measuredFrom = view->getFrameTimes().size();
+        view->runFrames(frames);
+        reusedVertices = (int)director->getRenderer()->getReusedVertices();
+
+        std::vector<double> times(view->getFrameTimes().begin() + measuredFrom, view->getFrameTimes().end());
+        std::sort(times.begin(), times.end());
+        return times.empty() ? 0.0 : times[times.size() / 2];
+    }
+}
+
+int main(int argc, char** argv) {
+    int iterations = 200;
+    int frames = 300;
+    std::vector<int> spriteCounts;
+
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--iterations") == 0 && i + 1 < argc) {
+            iterations = std::max(1, atoi(argv[++i]));
+        }
+        else if (strcmp(argv[i], "--frames") == 0 && i + 1 < argc) {
+            frames = std::max(1, atoi(argv[++i]));
+        }
+        else if (strcmp(argv[i], "--sprites") == 0 && i + 1 < argc) {
+            spriteCounts.push_back(std::max(1, atoi(argv[++i])));
+        }
+        else if (strcmp(argv[i], "--help") == 0 || strcmp(argv[i], "-h") == 0) {
+            printUsage();
+            return 0;
+        }
+        else {
+            printUsage();
+            return 1;
+        }
+    }
+    if (spriteCounts.empty()) spriteCounts = { 100, 1000, 10000 };
+
+    // 1. 核心循环
+    int mismatches = 0;
+    printf("kernel,sprites,vertices,legacy_us,simd_us,legacy_mverts_s,simd_mverts_s,speedup\n");
+    for (int sprites : spriteCounts) {
+        auto quads = clampToBatch(makeQuads(sprites, (unsigned)sprites));
+        size_t vertexCount = quads.size() * 4;
+        std::vector<V3F_C4B_T2F> legacyVerts(vertexCount), simdVerts(vertexCount);
+        std::vector<unsigned short> legacyIndices(quads.size() * 6), simdIndices(quads.size() * 6);
+
+        fillLegacy(quads, legacyVerts.data(), legacyIndices.data());
+        fillSimd(quads, simdVerts.data(), simdIndices.data());
+        if (memcmp(legacyVerts.data(), simdVerts.data(), vertexCount * sizeof(V3F_C4B_T2F)) != 0
+            || legacyIndices != simdIndices) {
+            fprintf(stderr, "results differ: %d sprites\n", sprites);
+            mismatches++;
+        }
+
+        double legacyUs = measure(quads, iterations, legacyVerts.data(), legacyIndices.data(), fillLegacy);
+        double simdUs = measure(quads, iterations, simdVerts.data(), simdIndices.data(), fillSimd);
+        printf("fill,%d,%d,%.1f,%.1f,%.1f,%.1f,%.2f\n", (int)quads.size(), (int)vertexCount, legacyUs, simdUs,
+            legacyUs > 0 ? vertexCount / legacyUs : 0.0, simdUs > 0 ? vertexCount / simdUs : 0.0,
+            simdUs > 0 ? legacyUs / simdUs : 0.0);
+    }
+
+    // 2. 整帧 (null 后端)
+    BenchApplication app;
+    backend::DeviceNull::select();
+    auto director = Director::getInstance();
+    auto view = GLViewHeadless::create("render_batch_bench", Size(540, 1040));
+    director->setOpenGLView(view);
+    director->setAnimationInterval(1.0f / 60);
+
+    printf("scene,sprites,vertices,frame_ms,mverts_s,reused_vertices\n");
+    for (int sprites : spriteCounts) {
+        for (bool rotating : { false, true }) {
+            int reusedVertices = 0;
+            double frameMs = measureFrames(view, sprites, rotating, frames, reusedVertices);
+            int vertices = sprites * 4;
+            printf("%s,%d,%d,%.4f,%.1f,%d\n", rotating ? "rotating" : "static", sprites, vertices, frameMs,
+                frameMs > 0 ? vertices / (frameMs * 1000.0) : 0.0, reusedVertices);
+        }
+    }
+
+    director->end();
+    director->mainLoop();
+    return mismatches > 0 ? 1 : 0;
+}
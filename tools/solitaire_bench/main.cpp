@@ -0,0 +1,356 @@
+/**
+ * @file main.cpp
+ * @brief solitaire_bench 基准测试
+ * 不创建窗口，直接驱动 Classes 下的 Model / 规则 / 历史代码，按 52、520、5200 张牌三档规模测量热点操作：
+ * 关卡 JSON 解析、GameModelGenerator::generate、翻面计算、hasAnyMove、抽牌与撤销。
+ * 每项先预热再采样，输出单次操作耗时的最小值 / 中位数 / 均值 / P95 / 标准差。
+ * 结果以 JSON 输出，可与上一次构建的结果对比：传入 --baseline 时中位数变慢超过阈值的项记为回归并返回非 0。
+ *
+ * 用法: solitaire_bench [--samples N] [--warmup N] [--scale N]... [--out FILE] [--baseline FILE] [--threshold R]
+ */
+#include "cocos2d.h"
+#include "configs/LevelConfigLoader.h"
+#include "configs/LevelConfigWriter.h"
+#include "managers/UndoManager.h"
+#include "services/GameModelGenerator.h"
+#include "services/GameRuleService.h"
+#include "json/document.h"
+#include "json/prettywriter.h"
+#include "json/stringbuffer.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+USING_NS_CC;
+
+namespace {
+    /**
+     * @brief 单项基准结果 (时间均为单次操作的纳秒数)
+     */
+    struct BenchResult {
+        std::string name;
+        int scale = 0;              ///< 关卡中的牌数
+        int opsPerSample = 1;       ///< 每个样本包含的操作次数
+        int samples = 0;
+        double minNs = 0.0;
+        double medianNs = 0.0;
+        double meanNs = 0.0;
+        double p95Ns = 0.0;
+        double stddevNs = 0.0;
+    };
+
+    struct BenchOptions {
+        int samples = 30;
+        int warmup = 5;
+    };
+
+    // 防止被测结果被编译器优化掉
+    volatile long long g_sink = 0;
+
+    /**
+     * @brief 运行一项基准
+     * @param setup 每个样本前执行，不计时 (如重新生成牌局)
+     * @param body 计时部分，共执行 opsPerSample 次操作
+     */
+    BenchResult runBench(const std::string& name, int scale, int opsPerSample, const BenchOptions& options,
+        const std::function<void()>& setup, const std::function<void()>& body) {
+        for (int i = 0; i < options.warmup; ++i) {
+            setup();
+            body();
+        }
+
+        std::vector<double> perOp;
+        perOp.reserve(options.samples);
+        for (int i = 0; i < options.samples; ++i) {
+            setup();
+            auto start = std::chrono::steady_clock::now();
+            body();
+            double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+            perOp.push_back(ns / opsPerSample);
+        }
+
+        BenchResult result;
+        result.name = name;
+        result.scale = scale;
+        result.opsPerSample = opsPerSample;
+        result.samples = (int)perOp.size();
+
+        std::sort(perOp.begin(), perOp.end());
+        double sum = 0.0;
+        for (double v : perOp) sum += v;
+        result.meanNs = sum / perOp.size();
+
+        double sq = 0.0;
+        for (double v : perOp) sq += (v - result.meanNs) * (v - result.meanNs);
+        result.stddevNs = perOp.size() > 1 ? std::sqrt(sq / (perOp.size() - 1)) : 0.0;
+
+        result.minNs = perOp.front();
+        result.medianNs = perOp[perOp.size() / 2];
+        result.p95Ns = perOp[std::min(perOp.size() - 1, (size_t)std::ceil(perOp.size() * 0.95) - 1)];
+
+        fprintf(stderr, "%-20s %6d  median %12.1f ns  p95 %12.1f ns\n", name.c_str(), scale, result.medianNs, result.p95Ns);
+        return result;
+    }
+
+    /**
+     * @brief 生成指定牌数的关卡：桌面牌按行错位排布 (相邻行互相遮挡)，另配 24 张备用牌
+     * 桌面牌每 52 张使用一副新牌，备用牌取自再下一副，因此每个规模都是真实的多副牌关卡。
+     */
+    LevelConfig makeLevel(int cards) {
+        const int kColumns = 6;
+        LevelConfig config;
+        config.levelId = cards;
+        for (int i = 0; i < cards; ++i) {
+            CardConfigData card;
+            card.cardFace = i % 13 + 1;
+            card.cardSuit = (i / 13) % 4;
+            card.x = 140.0f + (i % kColumns) * 160.0f + ((i / kColumns) % 2) * 80.0f;
+            card.y = 1800.0f - (float)((i / kColumns) % 24) * 60.0f;
+            card.zOrder = i;
+            card.isFaceUp = false;
+            card.deck = (uint8_t)(i / kCardsPerDeck);
+            config.playfieldCards.push_back(card);
+        }
+        for (int i = 0; i < 24; ++i) {
+            CardConfigData card;
+            card.cardFace = (i * 7) % 13 + 1;
+            card.cardSuit = (i + 1) % 4;
+            card.x = 0.0f;
+            card.y = 0.0f;
+            card.zOrder = 0;
+            card.isFaceUp = false;
+            card.deck = (uint8_t)((cards + kCardsPerDeck - 1) / kCardsPerDeck);
+            config.drawStackCards.push_back(card);
+        }
+        return config;
+    }
+
+    /**
+     * @brief 预先按贪心策略 (能点就点，否则抽牌) 走一局，得到可重复执行的操作序列
+     */
+    std::vector<MoveRecord> recordPlayout(const LevelConfig& config, int maxMoves) {
+        auto model = GameModel::create();
+        GameModelGenerator::generate(model, config);
+        GameRuleService::updateFaceUpStates(model);
+
+        std::vector<MoveRecord> records;
+        UndoManager undoManager;
+        undoManager.reset(model);
+        while ((int)records.size() < maxMoves) {
+            MoveRecord record;
+            bool found = false;
+            auto top = model->getCardById(model->getTopCardId());
+            for (auto card : model->getAllCards()) {
+                if (card->getState() == CardState::Playfield && card->isFaceUp() && GameRuleService::canMatch(card, top)) {
+                    record = MoveRecord::makeMove(card->getId(), model->getTopCardId(), CardState::Playfield);
+                    found = true;
+                    break;
+                }
+            }
+            if (!found) {
+                int count = 0;
+                const int* next = model->peekNextDrawCards(1, count);
+                if (count == 0) break;
+                record = MoveRecord::makeDraw(next[0], model->getTopCardId());
+            }
+            undoManager.execute(record);
+            records.push_back(record);
+        }
+        return records;
+    }
+
+    void runScale(int scale, const BenchOptions& options, std::vector<BenchResult>& results) {
+        LevelConfig config = makeLevel(scale);
+        std::string json = LevelConfigWriter::toJson(config, true);
+
+        // 1. 关卡加载：与 LevelConfigLoader::loadLevel 相同 (原地解析 + 构建遮挡图)，不含磁盘 I/O
+        results.push_back(runBench("load_level_json", scale, 1, options, []() {}, [&]() {
+            std::string buffer = json;
+            LevelConfig loaded;
+            LevelConfigLoader::parseLevel(&buffer[0], buffer.size(), loaded);
+            loaded.coverGraph = GameRuleService::buildCoverGraph(loaded.playfieldCards);
+            g_sink += loaded.coverGraph.getNodeCount();
+        }));
+
+        AutoreleasePool pool;
+        auto model = GameModel::create();
+
+        // 2. 牌局生成
+        results.push_back(runBench("generate", scale, 1, options, []() {}, [&]() {
+            GameModelGenerator::generate(model, config);
+            g_sink += model->getTopCardId();
+        }));
+
+        // 3. 全量翻面计算与死局判定
+        GameModelGenerator::generate(model, config);
+        results.push_back(runBench("update_face_up", scale, 1, options, []() {}, [&]() {
+            GameRuleService::updateFaceUpStates(model);
+            g_sink += model->getActiveBlockerCounts().size();
+        }));
+
+        const int kQueryOps = 1000;
+        results.push_back(runBench("has_any_move", scale, kQueryOps, options, []() {}, [&]() {
+            for (int i = 0; i < kQueryOps; ++i) g_sink += GameRuleService::hasAnyMove(model) ? 1 : 0;
+        }));
+
+        // 4. 抽牌：每个样本前按规模重新填满牌堆
+        results.push_back(runBench("pop_next_draw_card", scale, scale, options, [&]() {
+            model->clearDrawStack();
+            for (int i = 0; i < scale; ++i) model->pushToDrawStack(i);
+        }, [&]() {
+            for (int i = 0; i < scale; ++i) g_sink += model->popNextDrawCard();
+        }));
+
+        // 5. 历史：执行与撤销同一段操作序列 (只修改 Model，与回放校验相同)
+        std::vector<MoveRecord> records = recordPlayout(config, 200);
+        if (records.empty()) return;
+
+        UndoManager undoManager;
+        auto resetGame = [&]() {
+            GameModelGenerator::generate(model, config);
+            GameRuleService::updateFaceUpStates(model);
+            undoManager.reset(model);
+        };
+        results.push_back(runBench("undo_manager_execute", scale, (int)records.size(), options, resetGame, [&]() {
+            for (const auto& record : records) undoManager.execute(record);
+        }));
+        results.push_back(runBench("undo_manager_undo", scale, (int)records.size(), options, [&]() {
+            resetGame();
+            for (const auto& record : records) undoManager.execute(record);
+        }, [&]() {
+            while (undoManager.undo()) {}
+        }));
+    }
+
+    std::string toJson(const std::vector<BenchResult>& results, const BenchOptions& options) {
+        rapidjson::StringBuffer buffer;
+        rapidjson::PrettyWriter<rapidjson::StringBuffer> writer(buffer);
+        writer.SetIndent(' ', 2);
+
+        writer.StartObject();
+        writer.Key("schema");
+        writer.Int(1);
+        writer.Key("samples");
+        writer.Int(options.samples);
+        writer.Key("warmup");
+        writer.Int(options.warmup);
+        writer.Key("results");
+        writer.StartArray();
+        for (const auto& result : results) {
+            writer.StartObject();
+            writer.Key("name");
+            writer.String(result.name.c_str());
+            writer.Key("scale");
+            writer.Int(result.scale);
+            writer.Key("opsPerSample");
+            writer.Int(result.opsPerSample);
+            writer.Key("minNs");
+            writer.Double(result.minNs);
+            writer.Key("medianNs");
+            writer.Double(result.medianNs);
+            writer.Key("meanNs");
+            writer.Double(result.meanNs);
+            writer.Key("p95Ns");
+            writer.Double(result.p95Ns);
+            writer.Key("stddevNs");
+            writer.Double(result.stddevNs);
+            writer.EndObject();
+        }
+        writer.EndArray();
+        writer.EndObject();
+        return std::string(buffer.GetString(), buffer.GetSize()) + "\n";
+    }
+
+    /**
+     * @brief 与基准结果对比中位数
+     * @return int 回归项数；基准文件不可读时返回 -1
+     */
+    int compareBaseline(const std::vector<BenchResult>& results, const std::string& file, double threshold) {
+        std::string json = FileUtils::getInstance()->getStringFromFile(file);
+        rapidjson::Document doc;
+        doc.Parse(json.c_str());
+        if (json.empty() || doc.HasParseError() || !doc.HasMember("results") || !doc["results"].IsArray()) {
+            fprintf(stderr, "unreadable baseline: %s\n", file.c_str());
+            return -1;
+        }
+
+        std::map<std::pair<std::string, int>, double> baseline;
+        for (const auto& item : doc["results"].GetArray()) {
+            if (!item.HasMember("name") || !item.HasMember("scale") || !item.HasMember("medianNs")) continue;
+            baseline[{ item["name"].GetString(), item["scale"].GetInt() }] = item["medianNs"].GetDouble();
+        }
+
+        int regressions = 0;
+        for (const auto& result : results) {
+            auto it = baseline.find({ result.name, result.scale });
+            if (it == baseline.end() || it->second <= 0.0) continue;
+
+            double ratio = result.medianNs / it->second;
+            if (ratio > 1.0 + threshold) {
+                fprintf(stderr, "REGRESSION %s @%d: %.1f -> %.1f ns (x%.2f)\n",
+                    result.name.c_str(), result.scale, it->second, result.medianNs, ratio);
+                regressions++;
+            }
+        }
+        return regressions;
+    }
+
+    void printUsage() {
+        printf("Usage: solitaire_bench [options]\n");
+        printf("  --samples N     timed samples per benchmark (default 30)\n");
+        printf("  --warmup N      untimed warm-up runs per benchmark (default 5)\n");
+        printf("  --scale N       card count to benchmark, repeatable (default: 52 520 5200)\n");
+        printf("  --out FILE      write JSON results to FILE instead of stdout\n");
+        printf("  --baseline FILE compare medians with a previous JSON result\n");
+        printf("  --threshold R   allowed median slowdown ratio before reporting a regression (default 0.10)\n");
+    }
+}
+
+int main(int argc, char** argv) {
+    BenchOptions options;
+    std::vector<int> scales;
+    std::string outFile;
+    std::string baselineFile;
+    double threshold = 0.10;
+
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--samples") == 0 && i + 1 < argc) options.samples = std::max(1, atoi(argv[++i]));
+        else if (strcmp(argv[i], "--warmup") == 0 && i + 1 < argc) options.warmup = std::max(0, atoi(argv[++i]));
+        else if (strcmp(argv[i], "--scale") == 0 && i + 1 < argc) scales.push_back(std::max(1, atoi(argv[++i])));
+        else if (strcmp(argv[i], "--out") == 0 && i + 1 < argc) outFile = argv[++i];
+        else if (strcmp(argv[i], "--baseline") == 0 && i + 1 < argc) baselineFile = argv[++i];
+        else if (strcmp(argv[i], "--threshold") == 0 && i + 1 < argc) threshold = atof(argv[++i]);
+        else {
+            printUsage();
+            return strcmp(argv[i], "--help") == 0 || strcmp(argv[i], "-h") == 0 ? 0 : 2;
+        }
+    }
+    if (scales.empty()) scales = { 52, 520, 5200 };
+
+    std::vector<BenchResult> results;
+    for (int scale : scales) {
+        runScale(scale, options, results);
+    }
+
+    std::string json = toJson(results, options);
+    if (outFile.empty()) {
+        fputs(json.c_str(), stdout);
+    }
+    else if (!FileUtils::getInstance()->writeStringToFile(json, outFile)) {
+        fprintf(stderr, "failed to write %s\n", outFile.c_str());
+        return 1;
+    }
+
+    if (!baselineFile.empty()) {
+        int regressions = compareBaseline(results, baselineFile, threshold);
+        if (regressions != 0) return 1;
+    }
+    return 0;
+}